@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace nstd
@@ -64,6 +68,11 @@ namespace nstd
     template <typename OutputIter, typename Size, typename... Args>
     OutputIter construct_n(OutputIter, Size, Args&&...);
 
+    template <typename OutputIter>
+    OutputIter construct_for_overwrite(OutputIter, OutputIter);
+    template <typename OutputIter, typename Size>
+    OutputIter construct_for_overwrite_n(OutputIter, Size);
+
     template <typename OutputIter, typename T>
     OutputIter construct_fill(OutputIter, OutputIter, const T&);
     template <typename OutputIter, typename Size, typename T>
@@ -99,6 +108,150 @@ namespace nstd
     OutputIter destruct(OutputIter, OutputIter);
     template <typename OutputIter, typename Size>
     OutputIter destruct_n(OutputIter, Size);
+
+    template <typename InputIter1, typename InputIter2, typename OutputIter>
+    OutputIter merge(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter);
+    template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+    OutputIter merge(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter, Compare);
+    template <typename BidirIt>
+    void inplace_merge(BidirIt, BidirIt, BidirIt);
+    template <typename BidirIt, typename Compare>
+    void inplace_merge(BidirIt, BidirIt, BidirIt, Compare);
+
+    template <typename InputIter1, typename InputIter2, typename OutputIter>
+    OutputIter set_union(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter);
+    template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+    OutputIter set_union(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter, Compare);
+    template <typename InputIter1, typename InputIter2, typename OutputIter>
+    OutputIter set_intersection(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter);
+    template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+    OutputIter set_intersection(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter, Compare);
+    template <typename InputIter1, typename InputIter2, typename OutputIter>
+    OutputIter set_difference(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter);
+    template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+    OutputIter set_difference(InputIter1, InputIter1, InputIter2, InputIter2, OutputIter, Compare);
+    template <typename InputIter1, typename InputIter2>
+    bool includes(InputIter1, InputIter1, InputIter2, InputIter2);
+    template <typename InputIter1, typename InputIter2, typename Compare>
+    bool includes(InputIter1, InputIter1, InputIter2, InputIter2, Compare);
+
+    template <typename InputIter>
+    typename std::iterator_traits<InputIter>::value_type reduce(InputIter, InputIter);
+    template <typename InputIter, typename T>
+    T reduce(InputIter, InputIter, T);
+    template <typename InputIter, typename T, typename BinaryOp>
+    T reduce(InputIter, InputIter, T, BinaryOp);
+
+    template <typename InputIter1, typename InputIter2, typename T>
+    T transform_reduce(InputIter1, InputIter1, InputIter2, T);
+    template <typename InputIter1, typename InputIter2, typename T, typename BinaryReduceOp, typename BinaryTransformOp>
+    T transform_reduce(InputIter1, InputIter1, InputIter2, T, BinaryReduceOp, BinaryTransformOp);
+    template <typename InputIter, typename T, typename BinaryReduceOp, typename UnaryTransformOp>
+    T transform_reduce(InputIter, InputIter, T, BinaryReduceOp, UnaryTransformOp);
+
+    template <typename InputIter, typename OutputIter>
+    OutputIter inclusive_scan(InputIter, InputIter, OutputIter);
+    template <typename InputIter, typename OutputIter, typename BinaryOp>
+    OutputIter inclusive_scan(InputIter, InputIter, OutputIter, BinaryOp);
+    template <typename InputIter, typename OutputIter, typename BinaryOp, typename T>
+    OutputIter inclusive_scan(InputIter, InputIter, OutputIter, BinaryOp, T);
+    template <typename InputIter, typename OutputIter, typename T>
+    OutputIter exclusive_scan(InputIter, InputIter, OutputIter, T);
+    template <typename InputIter, typename OutputIter, typename T, typename BinaryOp>
+    OutputIter exclusive_scan(InputIter, InputIter, OutputIter, T, BinaryOp);
+
+    template <typename ForwardIter>
+    std::pair<ForwardIter, ForwardIter> minmax_element(ForwardIter, ForwardIter);
+    template <typename ForwardIter, typename Compare>
+    std::pair<ForwardIter, ForwardIter> minmax_element(ForwardIter, ForwardIter, Compare);
+}
+
+namespace nstd
+{
+    namespace detail
+    {
+        struct less
+        {
+            template <typename T1, typename T2>
+            constexpr bool operator()(const T1& a, const T2& b) const { return a < b; }
+        };
+        struct plus
+        {
+            template <typename T1, typename T2>
+            constexpr auto operator()(const T1& a, const T2& b) const { return a + b; }
+        };
+        struct multiplies
+        {
+            template <typename T1, typename T2>
+            constexpr auto operator()(const T1& a, const T2& b) const { return a * b; }
+        };
+
+        // Pointer ranges of trivially copyable types are copied with memmove
+        template <typename InputIter, typename OutputIter>
+        using is_bulk_copyable = std::integral_constant<bool,
+            std::is_pointer<InputIter>::value && std::is_pointer<OutputIter>::value &&
+            std::is_same<typename std::remove_cv<typename std::remove_pointer<InputIter>::type>::type,
+                         typename std::remove_pointer<OutputIter>::type>::value &&
+            std::is_trivially_copyable<typename std::remove_pointer<OutputIter>::type>::value>;
+
+        template <typename T>
+        T* bulk_copy(const T* first, const T* last, T* d_first)
+        {
+            if (first != last) std::memmove(d_first, first, (last - first) * sizeof(T));
+            return d_first + (last - first);
+        }
+        template <typename T>
+        T* bulk_copy_backward(const T* first, const T* last, T* d_last)
+        {
+            if (first != last) std::memmove(d_last - (last - first), first, (last - first) * sizeof(T));
+            return d_last - (last - first);
+        }
+
+        // Merging switches to galloping when one random access range is much longer than the other
+        constexpr ptrdiff_t gallop_ratio = 8;
+
+        template <typename Iter1, typename Iter2>
+        using can_gallop = std::integral_constant<bool,
+            std::is_convertible<typename std::iterator_traits<Iter1>::iterator_category, std::random_access_iterator_tag>::value &&
+            std::is_convertible<typename std::iterator_traits<Iter2>::iterator_category, std::random_access_iterator_tag>::value>;
+
+        template <typename RandomIt1, typename RandomIt2>
+        bool skewed(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2)
+        {
+            ptrdiff_t len1 = last1 - first1, len2 = last2 - first2;
+            return len1 * gallop_ratio <= len2 || len2 * gallop_ratio <= len1;
+        }
+
+        // Exponential probe from first followed by binary search; Pred is true on a prefix of the range
+        template <typename RandomIt, typename Pred>
+        RandomIt gallop(RandomIt first, RandomIt last, Pred pred)
+        {
+            ptrdiff_t len = last - first, lo = 0, step = 1;
+            while (step <= len && pred(first[step - 1]))
+            {
+                lo = step;
+                step *= 2;
+            }
+            ptrdiff_t hi = nstd::min(step - 1, len);
+            while (lo < hi)
+            {
+                ptrdiff_t mid = lo + (hi - lo) / 2;
+                if (pred(first[mid])) lo = mid + 1;
+                else hi = mid;
+            }
+            return first + lo;
+        }
+        template <typename RandomIt, typename T, typename Compare>
+        RandomIt gallop_lower(RandomIt first, RandomIt last, const T& val, Compare cmp)
+        {
+            return gallop(first, last, [&](const auto& x) { return cmp(x, val); });
+        }
+        template <typename RandomIt, typename T, typename Compare>
+        RandomIt gallop_upper(RandomIt first, RandomIt last, const T& val, Compare cmp)
+        {
+            return gallop(first, last, [&](const auto& x) { return !cmp(val, x); });
+        }
+    }
 }
 
 template <typename T>
@@ -185,12 +338,89 @@ OutputIter nstd::fill_n(OutputIter d_first, Size cnt, const T& val)
         *d_first++ = val;
     return d_first;
 }
+namespace nstd
+{
+    namespace detail
+    {
+        template <typename InputIter, typename OutputIter>
+        OutputIter copy(InputIter first, InputIter last, OutputIter d_first, std::false_type)
+        {
+            while (first != last)
+                *d_first++ = *first++;
+            return d_first;
+        }
+        template <typename InputIter, typename OutputIter>
+        OutputIter copy(InputIter first, InputIter last, OutputIter d_first, std::true_type)
+        {
+            return nstd::detail::bulk_copy(first, last, d_first);
+        }
+        template <typename BidirIt1, typename BidirIt2>
+        BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last, std::false_type)
+        {
+            while (last != first)
+                *--d_last = *--last;
+            return d_last;
+        }
+        template <typename BidirIt1, typename BidirIt2>
+        BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last, std::true_type)
+        {
+            return nstd::detail::bulk_copy_backward(first, last, d_last);
+        }
+        template <typename InputIter, typename OutputIter>
+        OutputIter move(InputIter first, InputIter last, OutputIter d_first, std::false_type)
+        {
+            while (first != last)
+                *d_first++ = std::move(*first++);
+            return d_first;
+        }
+        template <typename InputIter, typename OutputIter>
+        OutputIter move(InputIter first, InputIter last, OutputIter d_first, std::true_type)
+        {
+            return nstd::detail::bulk_copy(first, last, d_first);
+        }
+        template <typename BidirIt1, typename BidirIt2>
+        BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last, std::false_type)
+        {
+            while (last != first)
+                *--d_last = std::move(*--last);
+            return d_last;
+        }
+        template <typename BidirIt1, typename BidirIt2>
+        BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last, std::true_type)
+        {
+            return nstd::detail::bulk_copy_backward(first, last, d_last);
+        }
+        template <typename InputIter, typename OutputIter>
+        OutputIter construct_copy(InputIter first, InputIter last, OutputIter d_first, std::false_type)
+        {
+            while (first != last)
+                new(d_first++) typename std::iterator_traits<OutputIter>::value_type(*first++);
+            return d_first;
+        }
+        template <typename InputIter, typename OutputIter>
+        OutputIter construct_copy(InputIter first, InputIter last, OutputIter d_first, std::true_type)
+        {
+            return nstd::detail::bulk_copy(first, last, d_first);
+        }
+        template <typename InputIter, typename OutputIter>
+        OutputIter construct_move(InputIter first, InputIter last, OutputIter d_first, std::false_type)
+        {
+            while (first != last)
+                new(d_first++) typename std::iterator_traits<OutputIter>::value_type(std::move(*first++));
+            return d_first;
+        }
+        template <typename InputIter, typename OutputIter>
+        OutputIter construct_move(InputIter first, InputIter last, OutputIter d_first, std::true_type)
+        {
+            return nstd::detail::bulk_copy(first, last, d_first);
+        }
+    }
+}
+
 template <typename InputIter, typename OutputIter>
 OutputIter nstd::copy(InputIter first, InputIter last, OutputIter d_first)
 {
-    while (first != last)
-        *d_first++ = *first++;
-    return d_first;
+    return nstd::detail::copy(first, last, d_first, nstd::detail::is_bulk_copyable<InputIter, OutputIter>());
 }
 template <typename InputIter, typename OutputIter>
 InputIter nstd::copy_to(InputIter first, OutputIter d_first, OutputIter d_last)
@@ -209,9 +439,7 @@ OutputIter nstd::copy_n(InputIter first, Size cnt, OutputIter d_first)
 template <typename BidirIt1, typename BidirIt2>
 BidirIt2 nstd::copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
-    while (last != first)
-        *--d_last = *--last;
-    return d_last;
+    return nstd::detail::copy_backward(first, last, d_last, nstd::detail::is_bulk_copyable<BidirIt1, BidirIt2>());
 }
 template <typename BidirIt1, typename BidirIt2>
 BidirIt1 nstd::copy_backward_to(BidirIt1 last, BidirIt2 d_first, BidirIt2 d_last)
@@ -230,9 +458,7 @@ BidirIt2 nstd::copy_backward_n(BidirIt1 last, Size cnt, BidirIt2 d_last)
 template <typename InputIter, typename OutputIter>
 OutputIter nstd::move(InputIter first, InputIter last, OutputIter d_first)
 {
-    while (first != last)
-        *d_first++ = std::move(*first++);
-    return d_first;
+    return nstd::detail::move(first, last, d_first, nstd::detail::is_bulk_copyable<InputIter, OutputIter>());
 }
 template <typename InputIter, typename OutputIter>
 InputIter nstd::move_to(InputIter first, OutputIter d_first, OutputIter d_last)
@@ -251,9 +477,7 @@ OutputIter nstd::move_n(InputIter first, Size cnt, OutputIter d_first)
 template <typename BidirIt1, typename BidirIt2>
 BidirIt2 nstd::move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
-    while (last != first)
-        *--d_last = std::move(*--last);
-    return d_last;
+    return nstd::detail::move_backward(first, last, d_last, nstd::detail::is_bulk_copyable<BidirIt1, BidirIt2>());
 }
 template <typename BidirIt1, typename BidirIt2>
 BidirIt1 nstd::move_backward_to(BidirIt1 last, BidirIt2 d_first, BidirIt2 d_last)
@@ -283,6 +507,20 @@ OutputIter nstd::construct_n(OutputIter d_first, Size cnt, Args&&... args)
         new(d_first++) typename std::iterator_traits<OutputIter>::value_type(args...);
     return d_first;
 }
+template <typename OutputIter>
+OutputIter nstd::construct_for_overwrite(OutputIter d_first, OutputIter d_last)
+{
+    while (d_first != d_last)
+        new(d_first++) typename std::iterator_traits<OutputIter>::value_type;
+    return d_first;
+}
+template <typename OutputIter, typename Size>
+OutputIter nstd::construct_for_overwrite_n(OutputIter d_first, Size cnt)
+{
+    while (cnt-- > 0)
+        new(d_first++) typename std::iterator_traits<OutputIter>::value_type;
+    return d_first;
+}
 template <typename OutputIter, typename T>
 OutputIter nstd::construct_fill(OutputIter d_first, OutputIter d_last, const T& val)
 {
@@ -300,9 +538,7 @@ OutputIter nstd::construct_fill_n(OutputIter d_first, Size cnt, const T& val)
 template <typename InputIter, typename OutputIter>
 OutputIter nstd::construct_copy(InputIter first, InputIter last, OutputIter d_first)
 {
-    while (first != last)
-        new(d_first++) typename std::iterator_traits<OutputIter>::value_type(*first++);
-    return d_first;
+    return nstd::detail::construct_copy(first, last, d_first, nstd::detail::is_bulk_copyable<InputIter, OutputIter>());
 }
 template <typename InputIter, typename OutputIter>
 InputIter nstd::construct_copy_to(InputIter first, OutputIter d_first, OutputIter d_last)
@@ -342,9 +578,7 @@ BidirIt2 nstd::construct_copy_backward_n(BidirIt1 last, Size cnt, BidirIt2 d_las
 template <typename InputIter, typename OutputIter>
 OutputIter nstd::construct_move(InputIter first, InputIter last, OutputIter d_first)
 {
-    while (first != last)
-        new(d_first++) typename std::iterator_traits<OutputIter>::value_type(std::move(*first++));
-    return d_first;
+    return nstd::detail::construct_move(first, last, d_first, nstd::detail::is_bulk_copyable<InputIter, OutputIter>());
 }
 template <typename InputIter, typename OutputIter>
 InputIter nstd::construct_move_to(InputIter first, OutputIter d_first, OutputIter d_last)
@@ -395,3 +629,445 @@ OutputIter nstd::destruct_n(OutputIter d_first, Size cnt)
         (d_first++)->std::iterator_traits<OutputIter>::value_type::~value_type();
     return d_first;
 }
+
+namespace nstd
+{
+    namespace detail
+    {
+        template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+        OutputIter merge(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp, std::false_type)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first2, *first1)) *d_first++ = *first2++;
+                else *d_first++ = *first1++;
+            }
+            d_first = nstd::copy(first1, last1, d_first);
+            return nstd::copy(first2, last2, d_first);
+        }
+        template <typename RandomIt1, typename RandomIt2, typename OutputIter, typename Compare>
+        OutputIter merge(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2, OutputIter d_first, Compare cmp, std::true_type)
+        {
+            if (!nstd::detail::skewed(first1, last1, first2, last2))
+                return nstd::detail::merge(first1, last1, first2, last2, d_first, cmp, std::false_type());
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first2, *first1))
+                {
+                    RandomIt2 run = nstd::detail::gallop_lower(first2, last2, *first1, cmp);
+                    d_first = nstd::copy(first2, run, d_first);
+                    first2 = run;
+                }
+                else
+                {
+                    RandomIt1 run = nstd::detail::gallop_upper(first1, last1, *first2, cmp);
+                    d_first = nstd::copy(first1, run, d_first);
+                    first1 = run;
+                }
+            }
+            d_first = nstd::copy(first1, last1, d_first);
+            return nstd::copy(first2, last2, d_first);
+        }
+
+        // Merge a moved-out buffer back in front of the second run; stops once the buffer is used up
+        template <typename InputIter, typename BidirIt, typename Compare>
+        void merge_back(InputIter buf, InputIter buf_last, BidirIt middle, BidirIt last, BidirIt d_first, Compare cmp, std::false_type)
+        {
+            while (buf != buf_last && middle != last)
+            {
+                if (cmp(*middle, *buf)) *d_first++ = std::move(*middle++);
+                else *d_first++ = std::move(*buf++);
+            }
+            nstd::move(buf, buf_last, d_first);
+        }
+        template <typename RandomIt1, typename RandomIt2, typename Compare>
+        void merge_back(RandomIt1 buf, RandomIt1 buf_last, RandomIt2 middle, RandomIt2 last, RandomIt2 d_first, Compare cmp, std::true_type)
+        {
+            if (!nstd::detail::skewed(buf, buf_last, middle, last))
+                return nstd::detail::merge_back(buf, buf_last, middle, last, d_first, cmp, std::false_type());
+            while (buf != buf_last && middle != last)
+            {
+                if (cmp(*middle, *buf))
+                {
+                    RandomIt2 run = nstd::detail::gallop_lower(middle, last, *buf, cmp);
+                    d_first = nstd::move(middle, run, d_first);
+                    middle = run;
+                }
+                else
+                {
+                    RandomIt1 run = nstd::detail::gallop_upper(buf, buf_last, *middle, cmp);
+                    d_first = nstd::move(buf, run, d_first);
+                    buf = run;
+                }
+            }
+            nstd::move(buf, buf_last, d_first);
+        }
+
+        template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+        OutputIter set_union(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp, std::false_type)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first1, *first2)) *d_first++ = *first1++;
+                else if (cmp(*first2, *first1)) *d_first++ = *first2++;
+                else { *d_first++ = *first1++; ++first2; }
+            }
+            d_first = nstd::copy(first1, last1, d_first);
+            return nstd::copy(first2, last2, d_first);
+        }
+        template <typename RandomIt1, typename RandomIt2, typename OutputIter, typename Compare>
+        OutputIter set_union(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2, OutputIter d_first, Compare cmp, std::true_type)
+        {
+            if (!nstd::detail::skewed(first1, last1, first2, last2))
+                return nstd::detail::set_union(first1, last1, first2, last2, d_first, cmp, std::false_type());
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first1, *first2))
+                {
+                    RandomIt1 run = nstd::detail::gallop_lower(first1, last1, *first2, cmp);
+                    d_first = nstd::copy(first1, run, d_first);
+                    first1 = run;
+                }
+                else if (cmp(*first2, *first1))
+                {
+                    RandomIt2 run = nstd::detail::gallop_lower(first2, last2, *first1, cmp);
+                    d_first = nstd::copy(first2, run, d_first);
+                    first2 = run;
+                }
+                else { *d_first++ = *first1++; ++first2; }
+            }
+            d_first = nstd::copy(first1, last1, d_first);
+            return nstd::copy(first2, last2, d_first);
+        }
+
+        template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+        OutputIter set_intersection(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp, std::false_type)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first1, *first2)) ++first1;
+                else if (cmp(*first2, *first1)) ++first2;
+                else { *d_first++ = *first1++; ++first2; }
+            }
+            return d_first;
+        }
+        template <typename RandomIt1, typename RandomIt2, typename OutputIter, typename Compare>
+        OutputIter set_intersection(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2, OutputIter d_first, Compare cmp, std::true_type)
+        {
+            if (!nstd::detail::skewed(first1, last1, first2, last2))
+                return nstd::detail::set_intersection(first1, last1, first2, last2, d_first, cmp, std::false_type());
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first1, *first2)) first1 = nstd::detail::gallop_lower(first1, last1, *first2, cmp);
+                else if (cmp(*first2, *first1)) first2 = nstd::detail::gallop_lower(first2, last2, *first1, cmp);
+                else { *d_first++ = *first1++; ++first2; }
+            }
+            return d_first;
+        }
+
+        template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+        OutputIter set_difference(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp, std::false_type)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first1, *first2)) *d_first++ = *first1++;
+                else if (cmp(*first2, *first1)) ++first2;
+                else { ++first1; ++first2; }
+            }
+            return nstd::copy(first1, last1, d_first);
+        }
+        template <typename RandomIt1, typename RandomIt2, typename OutputIter, typename Compare>
+        OutputIter set_difference(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2, OutputIter d_first, Compare cmp, std::true_type)
+        {
+            if (!nstd::detail::skewed(first1, last1, first2, last2))
+                return nstd::detail::set_difference(first1, last1, first2, last2, d_first, cmp, std::false_type());
+            while (first1 != last1 && first2 != last2)
+            {
+                if (cmp(*first1, *first2))
+                {
+                    RandomIt1 run = nstd::detail::gallop_lower(first1, last1, *first2, cmp);
+                    d_first = nstd::copy(first1, run, d_first);
+                    first1 = run;
+                }
+                else if (cmp(*first2, *first1)) first2 = nstd::detail::gallop_lower(first2, last2, *first1, cmp);
+                else { ++first1; ++first2; }
+            }
+            return nstd::copy(first1, last1, d_first);
+        }
+
+        template <typename InputIter1, typename InputIter2, typename Compare>
+        bool includes(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, Compare cmp, std::false_type)
+        {
+            while (first2 != last2)
+            {
+                if (first1 == last1 || cmp(*first2, *first1)) return false;
+                if (!cmp(*first1, *first2)) ++first2;
+                ++first1;
+            }
+            return true;
+        }
+        template <typename RandomIt1, typename RandomIt2, typename Compare>
+        bool includes(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2, Compare cmp, std::true_type)
+        {
+            if (last2 - first2 > last1 - first1) return false;
+            if (!nstd::detail::skewed(first1, last1, first2, last2))
+                return nstd::detail::includes(first1, last1, first2, last2, cmp, std::false_type());
+            while (first2 != last2)
+            {
+                first1 = nstd::detail::gallop_lower(first1, last1, *first2, cmp);
+                if (first1 == last1 || cmp(*first2, *first1)) return false;
+                ++first1;
+                ++first2;
+            }
+            return true;
+        }
+    }
+}
+
+template <typename InputIter1, typename InputIter2, typename OutputIter>
+OutputIter nstd::merge(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first)
+{
+    return nstd::merge(first1, last1, first2, last2, d_first, nstd::detail::less());
+}
+template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+OutputIter nstd::merge(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp)
+{
+    return nstd::detail::merge(first1, last1, first2, last2, d_first, cmp, nstd::detail::can_gallop<InputIter1, InputIter2>());
+}
+template <typename BidirIt>
+void nstd::inplace_merge(BidirIt first, BidirIt middle, BidirIt last)
+{
+    nstd::inplace_merge(first, middle, last, nstd::detail::less());
+}
+template <typename BidirIt, typename Compare>
+void nstd::inplace_merge(BidirIt first, BidirIt middle, BidirIt last, Compare cmp)
+{
+    typedef typename std::iterator_traits<BidirIt>::value_type value_type;
+    if (first == middle || middle == last) return;
+    size_t cnt = std::distance(first, middle);
+    value_type* buf = static_cast<value_type*>(::operator new(cnt * sizeof(value_type)));
+    nstd::construct_move(first, middle, buf);
+    nstd::detail::merge_back(buf, buf + cnt, middle, last, first, cmp, nstd::detail::can_gallop<value_type*, BidirIt>());
+    nstd::destruct(buf, buf + cnt);
+    ::operator delete(buf);
+}
+template <typename InputIter1, typename InputIter2, typename OutputIter>
+OutputIter nstd::set_union(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first)
+{
+    return nstd::set_union(first1, last1, first2, last2, d_first, nstd::detail::less());
+}
+template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+OutputIter nstd::set_union(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp)
+{
+    return nstd::detail::set_union(first1, last1, first2, last2, d_first, cmp, nstd::detail::can_gallop<InputIter1, InputIter2>());
+}
+template <typename InputIter1, typename InputIter2, typename OutputIter>
+OutputIter nstd::set_intersection(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first)
+{
+    return nstd::set_intersection(first1, last1, first2, last2, d_first, nstd::detail::less());
+}
+template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+OutputIter nstd::set_intersection(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp)
+{
+    return nstd::detail::set_intersection(first1, last1, first2, last2, d_first, cmp, nstd::detail::can_gallop<InputIter1, InputIter2>());
+}
+template <typename InputIter1, typename InputIter2, typename OutputIter>
+OutputIter nstd::set_difference(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first)
+{
+    return nstd::set_difference(first1, last1, first2, last2, d_first, nstd::detail::less());
+}
+template <typename InputIter1, typename InputIter2, typename OutputIter, typename Compare>
+OutputIter nstd::set_difference(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, OutputIter d_first, Compare cmp)
+{
+    return nstd::detail::set_difference(first1, last1, first2, last2, d_first, cmp, nstd::detail::can_gallop<InputIter1, InputIter2>());
+}
+template <typename InputIter1, typename InputIter2>
+bool nstd::includes(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2)
+{
+    return nstd::includes(first1, last1, first2, last2, nstd::detail::less());
+}
+template <typename InputIter1, typename InputIter2, typename Compare>
+bool nstd::includes(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2, Compare cmp)
+{
+    return nstd::detail::includes(first1, last1, first2, last2, cmp, nstd::detail::can_gallop<InputIter1, InputIter2>());
+}
+
+namespace nstd
+{
+    namespace detail
+    {
+        // Contiguous arithmetic ranges are reduced with independent accumulators, so the
+        // loop carries no serial dependency and the compiler can keep the lanes in vector registers
+        constexpr size_t reduce_lanes = 8;
+
+        template <typename Iter, typename T>
+        using can_unroll = std::integral_constant<bool, std::is_pointer<Iter>::value && std::is_arithmetic<T>::value>;
+
+        template <typename T, typename BinaryOp, typename Load>
+        T unrolled_reduce(size_t cnt, T init, BinaryOp op, Load load)
+        {
+            if (cnt < 2 * reduce_lanes)
+            {
+                for (size_t i = 0; i < cnt; ++i)
+                    init = op(init, load(i));
+                return init;
+            }
+            T acc[reduce_lanes];
+            for (size_t k = 0; k < reduce_lanes; ++k)
+                acc[k] = load(k);
+            size_t body = cnt - cnt % reduce_lanes;
+            for (size_t i = reduce_lanes; i < body; i += reduce_lanes)
+                for (size_t k = 0; k < reduce_lanes; ++k)
+                    acc[k] = op(acc[k], load(i + k));
+            for (size_t width = reduce_lanes / 2; width > 0; width /= 2)
+                for (size_t k = 0; k < width; ++k)
+                    acc[k] = op(acc[k], acc[k + width]);
+            for (size_t i = body; i < cnt; ++i)
+                acc[0] = op(acc[0], load(i));
+            return op(init, acc[0]);
+        }
+
+        template <typename InputIter, typename T, typename BinaryOp>
+        T reduce(InputIter first, InputIter last, T init, BinaryOp op, std::false_type)
+        {
+            for (; first != last; ++first)
+                init = op(init, *first);
+            return init;
+        }
+        template <typename InputIter, typename T, typename BinaryOp>
+        T reduce(InputIter first, InputIter last, T init, BinaryOp op, std::true_type)
+        {
+            return nstd::detail::unrolled_reduce(last - first, init, op, [first](size_t i) { return first[i]; });
+        }
+
+        template <typename InputIter1, typename InputIter2, typename T, typename BinaryReduceOp, typename BinaryTransformOp>
+        T transform_reduce(InputIter1 first1, InputIter1 last1, InputIter2 first2, T init, BinaryReduceOp reduce_op, BinaryTransformOp transform_op, std::false_type)
+        {
+            for (; first1 != last1; ++first1, ++first2)
+                init = reduce_op(init, transform_op(*first1, *first2));
+            return init;
+        }
+        template <typename InputIter1, typename InputIter2, typename T, typename BinaryReduceOp, typename BinaryTransformOp>
+        T transform_reduce(InputIter1 first1, InputIter1 last1, InputIter2 first2, T init, BinaryReduceOp reduce_op, BinaryTransformOp transform_op, std::true_type)
+        {
+            return nstd::detail::unrolled_reduce(last1 - first1, init, reduce_op, [&](size_t i) { return transform_op(first1[i], first2[i]); });
+        }
+        template <typename InputIter, typename T, typename BinaryReduceOp, typename UnaryTransformOp>
+        T transform_reduce(InputIter first, InputIter last, T init, BinaryReduceOp reduce_op, UnaryTransformOp transform_op, std::false_type)
+        {
+            for (; first != last; ++first)
+                init = reduce_op(init, transform_op(*first));
+            return init;
+        }
+        template <typename InputIter, typename T, typename BinaryReduceOp, typename UnaryTransformOp>
+        T transform_reduce(InputIter first, InputIter last, T init, BinaryReduceOp reduce_op, UnaryTransformOp transform_op, std::true_type)
+        {
+            return nstd::detail::unrolled_reduce(last - first, init, reduce_op, [&](size_t i) { return transform_op(first[i]); });
+        }
+    }
+}
+
+template <typename InputIter>
+typename std::iterator_traits<InputIter>::value_type nstd::reduce(InputIter first, InputIter last)
+{
+    return nstd::reduce(first, last, typename std::iterator_traits<InputIter>::value_type(), nstd::detail::plus());
+}
+template <typename InputIter, typename T>
+T nstd::reduce(InputIter first, InputIter last, T init)
+{
+    return nstd::reduce(first, last, init, nstd::detail::plus());
+}
+template <typename InputIter, typename T, typename BinaryOp>
+T nstd::reduce(InputIter first, InputIter last, T init, BinaryOp op)
+{
+    return nstd::detail::reduce(first, last, init, op, nstd::detail::can_unroll<InputIter, T>());
+}
+template <typename InputIter1, typename InputIter2, typename T>
+T nstd::transform_reduce(InputIter1 first1, InputIter1 last1, InputIter2 first2, T init)
+{
+    return nstd::transform_reduce(first1, last1, first2, init, nstd::detail::plus(), nstd::detail::multiplies());
+}
+template <typename InputIter1, typename InputIter2, typename T, typename BinaryReduceOp, typename BinaryTransformOp>
+T nstd::transform_reduce(InputIter1 first1, InputIter1 last1, InputIter2 first2, T init, BinaryReduceOp reduce_op, BinaryTransformOp transform_op)
+{
+    typedef std::integral_constant<bool, nstd::detail::can_unroll<InputIter1, T>::value && std::is_pointer<InputIter2>::value> unroll;
+    return nstd::detail::transform_reduce(first1, last1, first2, init, reduce_op, transform_op, unroll());
+}
+template <typename InputIter, typename T, typename BinaryReduceOp, typename UnaryTransformOp>
+T nstd::transform_reduce(InputIter first, InputIter last, T init, BinaryReduceOp reduce_op, UnaryTransformOp transform_op)
+{
+    return nstd::detail::transform_reduce(first, last, init, reduce_op, transform_op, nstd::detail::can_unroll<InputIter, T>());
+}
+template <typename InputIter, typename OutputIter>
+OutputIter nstd::inclusive_scan(InputIter first, InputIter last, OutputIter d_first)
+{
+    return nstd::inclusive_scan(first, last, d_first, nstd::detail::plus());
+}
+template <typename InputIter, typename OutputIter, typename BinaryOp>
+OutputIter nstd::inclusive_scan(InputIter first, InputIter last, OutputIter d_first, BinaryOp op)
+{
+    if (first == last) return d_first;
+    typename std::iterator_traits<InputIter>::value_type init = *first;
+    *d_first = init;
+    return nstd::inclusive_scan(++first, last, ++d_first, op, init);
+}
+template <typename InputIter, typename OutputIter, typename BinaryOp, typename T>
+OutputIter nstd::inclusive_scan(InputIter first, InputIter last, OutputIter d_first, BinaryOp op, T init)
+{
+    for (; first != last; ++first)
+    {
+        init = op(init, *first);
+        *d_first++ = init;
+    }
+    return d_first;
+}
+template <typename InputIter, typename OutputIter, typename T>
+OutputIter nstd::exclusive_scan(InputIter first, InputIter last, OutputIter d_first, T init)
+{
+    return nstd::exclusive_scan(first, last, d_first, init, nstd::detail::plus());
+}
+template <typename InputIter, typename OutputIter, typename T, typename BinaryOp>
+OutputIter nstd::exclusive_scan(InputIter first, InputIter last, OutputIter d_first, T init, BinaryOp op)
+{
+    for (; first != last; ++first)
+    {
+        T next = op(init, *first);
+        *d_first++ = init;
+        init = next;
+    }
+    return d_first;
+}
+template <typename ForwardIter>
+std::pair<ForwardIter, ForwardIter> nstd::minmax_element(ForwardIter first, ForwardIter last)
+{
+    return nstd::minmax_element(first, last, nstd::detail::less());
+}
+template <typename ForwardIter, typename Compare>
+std::pair<ForwardIter, ForwardIter> nstd::minmax_element(ForwardIter first, ForwardIter last, Compare cmp)
+{
+    std::pair<ForwardIter, ForwardIter> ret(first, first);
+    if (first == last || ++first == last) return ret;
+    if (cmp(*first, *ret.first)) ret.first = first;
+    else ret.second = first;
+    while (++first != last)
+    {
+        ForwardIter curr = first;
+        if (++first == last)
+        {
+            if (cmp(*curr, *ret.first)) ret.first = curr;
+            else if (!cmp(*curr, *ret.second)) ret.second = curr;
+            break;
+        }
+        if (cmp(*first, *curr))
+        {
+            if (cmp(*first, *ret.first)) ret.first = first;
+            if (!cmp(*curr, *ret.second)) ret.second = curr;
+        }
+        else
+        {
+            if (cmp(*curr, *ret.first)) ret.first = curr;
+            if (!cmp(*first, *ret.second)) ret.second = first;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,697 @@
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "algorithm.h"
+#include "vector.h"
+
+// In-memory B+ tree. Nodes are sized to a few cache lines and keep their keys in a
+// sorted array, with mapped values in a separate parallel array so searches only touch
+// keys. All entries live in the leaves, which are linked for range scans; inner nodes
+// only route. Splits and merges are done top-down in a single descent.
+//
+// Keys and mapped values must be default constructible and move assignable, since node
+// arrays hold constructed slots. Inserting or erasing invalidates all iterators.
+
+namespace nstd
+{
+    template <typename Key, typename T, typename Compare = std::less<Key>> class btree_map;
+    template <typename Key, typename Compare = std::less<Key>> class btree_set;
+
+    namespace detail
+    {
+        template <typename Key, typename Mapped, typename Compare> class btree;
+
+        // Bytes of keys and values per node; eight cache lines
+        constexpr size_t btree_node_bytes = 512;
+
+        // Mapped values of a leaf; empty for sets
+        template <typename Mapped, size_t N>
+        struct btree_vals
+        {
+            Mapped data[N];
+
+            void move(size_t first, size_t last, btree_vals& dst, size_t d_first)
+            {
+                nstd::move(data + first, data + last, dst.data + d_first);
+            }
+            void move_backward(size_t first, size_t last, size_t d_last)
+            {
+                nstd::move_backward(data + first, data + last, data + d_last);
+            }
+            void reset(size_t idx)
+            {
+                data[idx] = Mapped();
+            }
+            template <typename... Args>
+            void assign(size_t idx, Args&&... args)
+            {
+                data[idx] = Mapped(std::forward<Args>(args)...);
+            }
+            template <typename Key, typename Pair>
+            void assign_entry(Key& key, size_t idx, Pair&& entry)
+            {
+                key = std::forward<Pair>(entry).first;
+                data[idx] = std::forward<Pair>(entry).second;
+            }
+        };
+        template <size_t N>
+        struct btree_vals<void, N>
+        {
+            void move(size_t, size_t, btree_vals&, size_t) noexcept {}
+            void move_backward(size_t, size_t, size_t)     noexcept {}
+            void reset(size_t)                             noexcept {}
+            void assign(size_t)                            noexcept {}
+            template <typename Key, typename K>
+            void assign_entry(Key& key, size_t, K&& entry)
+            {
+                key = std::forward<K>(entry);
+            }
+        };
+
+        // Iterator dereference: a proxy pair for maps, the key for sets
+        template <typename Key, typename Mapped, bool Mutable>
+        struct btree_ref
+        {
+            typedef std::pair<const Key&, typename std::conditional<Mutable, Mapped&, const Mapped&>::type> reference;
+            typedef std::pair<const Key, Mapped>                                                           value_type;
+
+            struct pointer
+            {
+                reference ref;
+                const reference* operator->() const noexcept { return &ref; }
+            };
+
+            template <typename Vals>
+            static reference get(const Key& key, Vals& vals, size_t idx) noexcept { return reference(key, vals.data[idx]); }
+        };
+        template <typename Key, bool Mutable>
+        struct btree_ref<Key, void, Mutable>
+        {
+            typedef const Key&                            reference;
+            typedef Key                                   value_type;
+            typedef const Key*                            pointer;
+
+            template <typename Vals>
+            static reference get(const Key& key, Vals&, size_t) noexcept { return key; }
+        };
+    }
+}
+
+template <typename Key, typename Mapped, typename Compare>
+class nstd::detail::btree
+{
+public:
+
+    // Types
+    typedef Key                                   key_type;
+    typedef Compare                               key_compare;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+private:
+
+    static constexpr size_type mapped_size = std::is_void<Mapped>::value ? 0 : sizeof(typename std::conditional<std::is_void<Mapped>::value, char, Mapped>::type);
+    static constexpr size_type leaf_slots  = nstd::max(size_type(4), btree_node_bytes / (sizeof(Key) + mapped_size));
+    static constexpr size_type inner_slots = nstd::max(size_type(4), btree_node_bytes / (sizeof(Key) + sizeof(void*)));
+    static constexpr size_type leaf_min    = leaf_slots / 2;
+    static constexpr size_type inner_min   = (inner_slots - 1) / 2;
+
+    // Nodes
+    struct node
+    {
+        node(bool leaf) noexcept : count(0), leaf(leaf) {}
+        size_type count;
+        bool leaf;
+    };
+    struct inner : node
+    {
+        inner() : node(false) {}
+        Key keys[inner_slots];
+        node* child[inner_slots + 1];
+    };
+    struct leaf : node
+    {
+        leaf() : node(true), prev(nullptr), next(nullptr) {}
+        leaf* prev;
+        leaf* next;
+        Key keys[leaf_slots];
+        btree_vals<Mapped, leaf_slots> vals;
+    };
+
+    template <bool Mutable>
+    class iterator_t
+    {
+    public:
+
+        // Types
+        typedef std::bidirectional_iterator_tag                        iterator_category;
+        typedef typename btree_ref<Key, Mapped, Mutable>::value_type   value_type;
+        typedef typename btree_ref<Key, Mapped, Mutable>::reference    reference;
+        typedef typename btree_ref<Key, Mapped, Mutable>::pointer      pointer;
+        typedef ptrdiff_t                                              difference_type;
+
+        // Constructors
+        iterator_t()                              noexcept : ptr(nullptr), idx(0)             {}
+        template <bool Mut2, typename = std::enable_if_t<!Mutable && Mut2>>
+        iterator_t(const iterator_t<Mut2>& other) noexcept : ptr(other.ptr), idx(other.idx) {}
+
+        // Access
+        reference operator*()  const noexcept { return btree_ref<Key, Mapped, Mutable>::get(ptr->keys[idx], ptr->vals, idx); }
+        pointer operator->()   const noexcept { return arrow(std::is_void<Mapped>()); }
+
+        // Iteration
+        iterator_t& operator++()    noexcept { if (++idx == ptr->count && ptr->next) { ptr = ptr->next; idx = 0; } return *this; }
+        iterator_t& operator--()    noexcept { if (idx == 0) { ptr = ptr->prev; idx = ptr->count; } --idx; return *this; }
+        iterator_t operator++(int)  noexcept { iterator_t temp = *this; ++*this; return temp; }
+        iterator_t operator--(int)  noexcept { iterator_t temp = *this; --*this; return temp; }
+
+        // Comparisons
+        template <bool Mut2>
+        bool operator==(const iterator_t<Mut2>& other) const noexcept { return ptr == other.ptr && idx == other.idx; }
+        template <bool Mut2>
+        bool operator!=(const iterator_t<Mut2>& other) const noexcept { return !(*this == other); }
+
+    private:
+
+        // Node type
+        typedef typename std::conditional<Mutable, leaf*, const leaf*>::type leaf_ptr;
+
+        // Internal constructor
+        iterator_t(leaf_ptr ptr, size_type idx) noexcept : ptr(ptr), idx(idx) {}
+
+        pointer arrow(std::true_type)  const noexcept { return &ptr->keys[idx]; }
+        pointer arrow(std::false_type) const noexcept { return pointer{**this}; }
+
+        leaf_ptr ptr;
+        size_type idx;
+
+        template <bool Mut2>
+        friend class iterator_t;
+        friend class btree;
+    };
+
+public:
+
+    // Types
+    typedef iterator_t<true>                      iterator;
+    typedef iterator_t<false>                     const_iterator;
+
+    // Constructors
+    btree() noexcept : root_(nullptr), first_(nullptr), last_(nullptr), size_(0) {}
+    btree(const btree& other) : btree()
+    {
+        comp_ = other.comp_;
+        build(other.begin(), other.size_);
+    }
+    btree(btree&& other) noexcept : btree()
+    {
+        swap(other);
+    }
+    explicit btree(const Compare& comp) : root_(nullptr), first_(nullptr), last_(nullptr), size_(0), comp_(comp) {}
+
+    // Destructor
+    ~btree() noexcept
+    {
+        destroy(root_);
+    }
+
+    // Assignment
+    btree& operator=(btree other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Iterators
+    iterator begin()                       noexcept { return iterator(first_, 0);                          }
+    const_iterator begin()           const noexcept { return const_iterator(first_, 0);                    }
+    const_iterator cbegin()          const noexcept { return const_iterator(first_, 0);                    }
+    iterator end()                         noexcept { return iterator(last_, last_ ? last_->count : 0);      }
+    const_iterator end()             const noexcept { return const_iterator(last_, last_ ? last_->count : 0); }
+    const_iterator cend()            const noexcept { return const_iterator(last_, last_ ? last_->count : 0); }
+
+    // Size
+    bool empty()                     const noexcept { return size_ == 0; }
+    size_type size()                 const noexcept { return size_;      }
+    key_compare key_comp()           const          { return comp_;      }
+
+    // Lookup
+    iterator lower_bound(const key_type& key)                   { return to_mutable(find_bound(key, false)); }
+    const_iterator lower_bound(const key_type& key)       const { return find_bound(key, false);             }
+    iterator upper_bound(const key_type& key)                   { return to_mutable(find_bound(key, true));  }
+    const_iterator upper_bound(const key_type& key)       const { return find_bound(key, true);              }
+    iterator find(const key_type& key)                          { return to_mutable(find_exact(key));        }
+    const_iterator find(const key_type& key)              const { return find_exact(key);                    }
+    bool contains(const key_type& key)                    const { return find_exact(key) != end();           }
+    size_type count(const key_type& key)                  const { return contains(key) ? 1 : 0;              }
+
+    // Modifiers
+    size_type erase(const key_type& key)
+    {
+        if (!root_) return 0;
+        node* curr = root_;
+        while (!curr->leaf)
+        {
+            inner* in = static_cast<inner*>(curr);
+            size_type i = upper_index(in->keys, in->count, key);
+            if (in->child[i]->count <= min_count(in->child[i])) i = fill_child(in, i);
+            curr = in->child[i];
+            if (in == root_ && in->count == 0)
+            {
+                root_ = curr;
+                delete in;
+            }
+        }
+        return erase_from(static_cast<leaf*>(curr), key);
+    }
+    iterator erase(const_iterator pos)
+    {
+        key_type key = pos.ptr->keys[pos.idx];
+        erase(key);
+        return lower_bound(key);
+    }
+    void clear() noexcept
+    {
+        destroy(root_);
+        root_ = nullptr;
+        first_ = last_ = nullptr;
+        size_ = 0;
+    }
+    void swap(btree& other) noexcept
+    {
+        std::swap(root_, other.root_);
+        std::swap(first_, other.first_);
+        std::swap(last_, other.last_);
+        std::swap(size_, other.size_);
+        std::swap(comp_, other.comp_);
+    }
+
+protected:
+
+    // Insert key if absent, assigning the mapped value from args
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplace_unique(K&& key, Args&&... args)
+    {
+        if (!root_) root_ = first_ = last_ = new leaf;
+        if (full(root_))
+        {
+            inner* in = new inner;
+            in->child[0] = root_;
+            root_ = in;
+            split_child(in, 0);
+        }
+        node* curr = root_;
+        while (!curr->leaf)
+        {
+            inner* in = static_cast<inner*>(curr);
+            size_type i = upper_index(in->keys, in->count, key);
+            if (full(in->child[i]))
+            {
+                split_child(in, i);
+                if (!comp_(key, in->keys[i])) ++i;
+            }
+            curr = in->child[i];
+        }
+        leaf* lf = static_cast<leaf*>(curr);
+        size_type pos = lower_index(lf->keys, lf->count, key);
+        if (pos < lf->count && !comp_(key, lf->keys[pos])) return std::pair<iterator, bool>(iterator(lf, pos), false);
+        shift_right(lf, pos);
+        lf->keys[pos] = std::forward<K>(key);
+        lf->vals.assign(pos, std::forward<Args>(args)...);
+        ++size_;
+        return std::pair<iterator, bool>(iterator(lf, pos), true);
+    }
+
+    // Bulk load from cnt strictly increasing entries; leaves are packed full
+    template <typename InputIter>
+    void build(InputIter first, size_type cnt)
+    {
+        clear();
+        if (cnt == 0) return;
+        size_type leaves = (cnt + leaf_slots - 1) / leaf_slots;
+        vector<node*> level;
+        vector<key_type> lows;
+        level.reserve(leaves);
+        lows.reserve(leaves);
+        for (size_type j = 0; j < leaves; ++j)
+        {
+            leaf* lf = new leaf;
+            lf->count = cnt / leaves + (j < cnt % leaves);
+            for (size_type k = 0; k < lf->count; ++k, ++first)
+                lf->vals.assign_entry(lf->keys[k], k, *first);
+            lf->prev = last_;
+            if (last_) last_->next = lf;
+            else first_ = lf;
+            last_ = lf;
+            level.push_back(lf);
+            lows.push_back(lf->keys[0]);
+        }
+        while (level.size() > 1)
+        {
+            size_type cnt_nodes = level.size();
+            size_type groups = (cnt_nodes + inner_slots) / (inner_slots + 1);
+            vector<node*> parents;
+            vector<key_type> parent_lows;
+            parents.reserve(groups);
+            parent_lows.reserve(groups);
+            size_type idx = 0;
+            for (size_type j = 0; j < groups; ++j)
+            {
+                inner* in = new inner;
+                size_type take = cnt_nodes / groups + (j < cnt_nodes % groups);
+                parent_lows.push_back(std::move(lows[idx]));
+                in->child[0] = level[idx++];
+                for (size_type k = 1; k < take; ++k, ++idx)
+                {
+                    in->keys[k - 1] = std::move(lows[idx]);
+                    in->child[k] = level[idx];
+                }
+                in->count = take - 1;
+                parents.push_back(in);
+            }
+            level.swap(parents);
+            lows.swap(parent_lows);
+        }
+        root_ = level[0];
+        size_ = cnt;
+    }
+
+private:
+
+    // Utility functions
+    static iterator to_mutable(const_iterator it) noexcept
+    {
+        return iterator(const_cast<leaf*>(it.ptr), it.idx);
+    }
+    static bool full(const node* curr) noexcept
+    {
+        return curr->count == (curr->leaf ? leaf_slots : inner_slots);
+    }
+    static size_type min_count(const node* curr) noexcept
+    {
+        return curr->leaf ? leaf_min : inner_min;
+    }
+    static void destroy(node* curr) noexcept
+    {
+        if (!curr) return;
+        if (curr->leaf)
+        {
+            delete static_cast<leaf*>(curr);
+            return;
+        }
+        inner* in = static_cast<inner*>(curr);
+        for (size_type i = 0; i <= in->count; ++i)
+            destroy(in->child[i]);
+        delete in;
+    }
+
+    // Binary search within a node's key array
+    size_type lower_index(const Key* keys, size_type cnt, const key_type& key) const
+    {
+        size_type lo = 0;
+        while (cnt > 0)
+        {
+            size_type half = cnt / 2;
+            if (comp_(keys[lo + half], key)) { lo += half + 1; cnt -= half + 1; }
+            else cnt = half;
+        }
+        return lo;
+    }
+    size_type upper_index(const Key* keys, size_type cnt, const key_type& key) const
+    {
+        size_type lo = 0;
+        while (cnt > 0)
+        {
+            size_type half = cnt / 2;
+            if (!comp_(key, keys[lo + half])) { lo += half + 1; cnt -= half + 1; }
+            else cnt = half;
+        }
+        return lo;
+    }
+
+    const leaf* find_leaf(const key_type& key) const
+    {
+        const node* curr = root_;
+        while (!curr->leaf)
+        {
+            const inner* in = static_cast<const inner*>(curr);
+            curr = in->child[upper_index(in->keys, in->count, key)];
+        }
+        return static_cast<const leaf*>(curr);
+    }
+    const_iterator find_bound(const key_type& key, bool upper) const
+    {
+        if (!root_) return end();
+        const leaf* lf = find_leaf(key);
+        size_type pos = upper ? upper_index(lf->keys, lf->count, key) : lower_index(lf->keys, lf->count, key);
+        if (pos == lf->count && lf->next) return const_iterator(lf->next, 0);
+        return const_iterator(lf, pos);
+    }
+    const_iterator find_exact(const key_type& key) const
+    {
+        if (!root_) return end();
+        const leaf* lf = find_leaf(key);
+        size_type pos = lower_index(lf->keys, lf->count, key);
+        if (pos < lf->count && !comp_(key, lf->keys[pos])) return const_iterator(lf, pos);
+        return end();
+    }
+
+    // Entry shifting within and between leaves
+    static void shift_right(leaf* lf, size_type pos)
+    {
+        nstd::move_backward(lf->keys + pos, lf->keys + lf->count, lf->keys + lf->count + 1);
+        lf->vals.move_backward(pos, lf->count, lf->count + 1);
+        ++lf->count;
+    }
+    static void move_entries(leaf* src, size_type first, size_type last, leaf* dst, size_type d_first)
+    {
+        nstd::move(src->keys + first, src->keys + last, dst->keys + d_first);
+        src->vals.move(first, last, dst->vals, d_first);
+    }
+    size_type erase_from(leaf* lf, const key_type& key)
+    {
+        size_type pos = lower_index(lf->keys, lf->count, key);
+        if (pos == lf->count || comp_(key, lf->keys[pos])) return 0;
+        move_entries(lf, pos + 1, lf->count, lf, pos);
+        --lf->count;
+        lf->keys[lf->count] = key_type();
+        lf->vals.reset(lf->count);
+        if (--size_ == 0) clear();
+        return 1;
+    }
+
+    // Split the full child i of in, which must not be full itself
+    void split_child(inner* in, size_type i)
+    {
+        node* right;
+        key_type sep;
+        if (in->child[i]->leaf)
+        {
+            leaf* lf = static_cast<leaf*>(in->child[i]);
+            leaf* rt = new leaf;
+            size_type half = lf->count / 2;
+            move_entries(lf, half, lf->count, rt, 0);
+            rt->count = lf->count - half;
+            lf->count = half;
+            rt->prev = lf;
+            rt->next = lf->next;
+            if (rt->next) rt->next->prev = rt;
+            else last_ = rt;
+            lf->next = rt;
+            sep = rt->keys[0];
+            right = rt;
+        }
+        else
+        {
+            inner* lf = static_cast<inner*>(in->child[i]);
+            inner* rt = new inner;
+            size_type half = lf->count / 2;
+            sep = std::move(lf->keys[half]);
+            nstd::move(lf->keys + half + 1, lf->keys + lf->count, rt->keys);
+            nstd::move(lf->child + half + 1, lf->child + lf->count + 1, rt->child);
+            rt->count = lf->count - half - 1;
+            lf->count = half;
+            right = rt;
+        }
+        nstd::move_backward(in->keys + i, in->keys + in->count, in->keys + in->count + 1);
+        nstd::move_backward(in->child + i + 1, in->child + in->count + 1, in->child + in->count + 2);
+        in->keys[i] = std::move(sep);
+        in->child[i + 1] = right;
+        ++in->count;
+    }
+
+    // Give child i of in more than the minimum count; returns the child's new index
+    size_type fill_child(inner* in, size_type i)
+    {
+        if (i > 0 && in->child[i - 1]->count > min_count(in->child[i - 1]))
+        {
+            borrow_left(in, i);
+            return i;
+        }
+        if (i < in->count && in->child[i + 1]->count > min_count(in->child[i + 1]))
+        {
+            borrow_right(in, i);
+            return i;
+        }
+        if (i > 0) --i;
+        merge_children(in, i);
+        return i;
+    }
+    void borrow_left(inner* in, size_type i)
+    {
+        if (in->child[i]->leaf)
+        {
+            leaf* lt = static_cast<leaf*>(in->child[i - 1]);
+            leaf* curr = static_cast<leaf*>(in->child[i]);
+            shift_right(curr, 0);
+            move_entries(lt, lt->count - 1, lt->count, curr, 0);
+            --lt->count;
+            in->keys[i - 1] = curr->keys[0];
+            return;
+        }
+        inner* lt = static_cast<inner*>(in->child[i - 1]);
+        inner* curr = static_cast<inner*>(in->child[i]);
+        nstd::move_backward(curr->keys, curr->keys + curr->count, curr->keys + curr->count + 1);
+        nstd::move_backward(curr->child, curr->child + curr->count + 1, curr->child + curr->count + 2);
+        curr->keys[0] = std::move(in->keys[i - 1]);
+        curr->child[0] = lt->child[lt->count];
+        in->keys[i - 1] = std::move(lt->keys[lt->count - 1]);
+        --lt->count;
+        ++curr->count;
+    }
+    void borrow_right(inner* in, size_type i)
+    {
+        if (in->child[i]->leaf)
+        {
+            leaf* curr = static_cast<leaf*>(in->child[i]);
+            leaf* rt = static_cast<leaf*>(in->child[i + 1]);
+            move_entries(rt, 0, 1, curr, curr->count);
+            ++curr->count;
+            move_entries(rt, 1, rt->count, rt, 0);
+            --rt->count;
+            in->keys[i] = rt->keys[0];
+            return;
+        }
+        inner* curr = static_cast<inner*>(in->child[i]);
+        inner* rt = static_cast<inner*>(in->child[i + 1]);
+        curr->keys[curr->count] = std::move(in->keys[i]);
+        curr->child[curr->count + 1] = rt->child[0];
+        ++curr->count;
+        in->keys[i] = std::move(rt->keys[0]);
+        nstd::move(rt->keys + 1, rt->keys + rt->count, rt->keys);
+        nstd::move(rt->child + 1, rt->child + rt->count + 1, rt->child);
+        --rt->count;
+    }
+    // Merge child i + 1 of in into child i
+    void merge_children(inner* in, size_type i)
+    {
+        if (in->child[i]->leaf)
+        {
+            leaf* lt = static_cast<leaf*>(in->child[i]);
+            leaf* rt = static_cast<leaf*>(in->child[i + 1]);
+            move_entries(rt, 0, rt->count, lt, lt->count);
+            lt->count += rt->count;
+            lt->next = rt->next;
+            if (lt->next) lt->next->prev = lt;
+            else last_ = lt;
+            delete rt;
+        }
+        else
+        {
+            inner* lt = static_cast<inner*>(in->child[i]);
+            inner* rt = static_cast<inner*>(in->child[i + 1]);
+            lt->keys[lt->count] = std::move(in->keys[i]);
+            nstd::move(rt->keys, rt->keys + rt->count, lt->keys + lt->count + 1);
+            nstd::move(rt->child, rt->child + rt->count + 1, lt->child + lt->count + 1);
+            lt->count += rt->count + 1;
+            delete rt;
+        }
+        nstd::move(in->keys + i + 1, in->keys + in->count, in->keys + i);
+        nstd::move(in->child + i + 2, in->child + in->count + 1, in->child + i + 1);
+        --in->count;
+    }
+
+    node* root_;
+    leaf* first_;
+    leaf* last_;
+    size_type size_;
+    Compare comp_;
+};
+
+template <typename Key, typename T, typename Compare>
+class nstd::btree_map : public nstd::detail::btree<Key, T, Compare>
+{
+    typedef detail::btree<Key, T, Compare> base;
+
+public:
+
+    // Types
+    typedef T                                     mapped_type;
+    typedef std::pair<const Key, T>               value_type;
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+
+    // Constructors
+    btree_map() noexcept {}
+    explicit btree_map(const Compare& comp) : base(comp) {}
+    btree_map(const vector<std::pair<Key, T>>& sorted)          { this->build(sorted.begin(), sorted.size());                           }
+    btree_map(vector<std::pair<Key, T>>&& sorted)               { this->build(std::make_move_iterator(sorted.begin()), sorted.size()); }
+
+    // Element access
+    T& operator[](const Key& key)                   { return this->emplace_unique(key).first->second;            }
+    T& operator[](Key&& key)                        { return this->emplace_unique(std::move(key)).first->second; }
+    T& at(const Key& key)
+    {
+        iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("nstd::btree_map::at");
+        return it->second;
+    }
+    const T& at(const Key& key) const
+    {
+        const_iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("nstd::btree_map::at");
+        return it->second;
+    }
+
+    // Modifiers
+    std::pair<iterator, bool> insert(const value_type& val)    { return this->emplace_unique(val.first, val.second); }
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return this->emplace_unique(key, std::forward<Args>(args)...);
+    }
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& val)
+    {
+        std::pair<iterator, bool> ret = this->emplace_unique(key);
+        ret.first->second = std::forward<M>(val);
+        return ret;
+    }
+};
+
+template <typename Key, typename Compare>
+class nstd::btree_set : public nstd::detail::btree<Key, void, Compare>
+{
+    typedef detail::btree<Key, void, Compare> base;
+
+public:
+
+    // Types
+    typedef Key                                   value_type;
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+
+    // Constructors
+    btree_set() noexcept {}
+    explicit btree_set(const Compare& comp) : base(comp) {}
+    btree_set(const vector<Key>& sorted)                        { this->build(sorted.begin(), sorted.size());                           }
+    btree_set(vector<Key>&& sorted)                             { this->build(std::make_move_iterator(sorted.begin()), sorted.size()); }
+
+    // Modifiers
+    std::pair<iterator, bool> insert(const Key& key)            { return this->emplace_unique(key);            }
+    std::pair<iterator, bool> insert(Key&& key)                 { return this->emplace_unique(std::move(key)); }
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <type_traits>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "vector.h"
+
+namespace nstd
+{
+    // Append up to cnt bytes to the end of buf, growing it without value-initialization.
+    // Return the number of bytes read or -1 with errno set; on failure buf is unchanged.
+    template <typename T>
+    ssize_t read(int fd, vector<T>& buf, size_t cnt);
+    template <typename T>
+    ssize_t pread(int fd, vector<T>& buf, size_t cnt, off_t offset);
+
+    // Fill the spare capacity (capacity() - size()) of each buffer in order.
+    template <typename T>
+    ssize_t readv(int fd, vector<T>* bufs, size_t num);
+
+    template <typename T>
+    ssize_t write(int fd, const vector<T>& buf);
+    template <typename T>
+    ssize_t pwrite(int fd, const vector<T>& buf, off_t offset);
+    template <typename T>
+    ssize_t writev(int fd, const vector<T>* bufs, size_t num);
+}
+
+namespace nstd
+{
+    namespace detail
+    {
+        template <typename T>
+        constexpr bool is_byte_buffer_v = sizeof(T) == 1 && std::is_trivially_copyable<T>::value;
+
+        template <typename T>
+        ssize_t finish_read(vector<T>& buf, size_t old_size, ssize_t res)
+        {
+            buf.resize(res < 0 ? old_size : old_size + res);
+            return res;
+        }
+    }
+}
+
+template <typename T>
+ssize_t nstd::read(int fd, vector<T>& buf, size_t cnt)
+{
+    static_assert(nstd::detail::is_byte_buffer_v<T>, "nstd::read requires a byte-sized trivially copyable type");
+    size_t old_size = buf.size();
+    buf.resize_for_overwrite(old_size + cnt);
+    return nstd::detail::finish_read(buf, old_size, ::read(fd, buf.data() + old_size, cnt));
+}
+template <typename T>
+ssize_t nstd::pread(int fd, vector<T>& buf, size_t cnt, off_t offset)
+{
+    static_assert(nstd::detail::is_byte_buffer_v<T>, "nstd::pread requires a byte-sized trivially copyable type");
+    size_t old_size = buf.size();
+    buf.resize_for_overwrite(old_size + cnt);
+    return nstd::detail::finish_read(buf, old_size, ::pread(fd, buf.data() + old_size, cnt, offset));
+}
+template <typename T>
+ssize_t nstd::readv(int fd, vector<T>* bufs, size_t num)
+{
+    static_assert(nstd::detail::is_byte_buffer_v<T>, "nstd::readv requires a byte-sized trivially copyable type");
+    vector<iovec> iov;
+    iov.resize_for_overwrite(num);
+    for (size_t i = 0; i < num; ++i)
+    {
+        size_t old_size = bufs[i].size();
+        bufs[i].resize_for_overwrite(bufs[i].capacity());
+        iov[i].iov_base = bufs[i].data() + old_size;
+        iov[i].iov_len = bufs[i].size() - old_size;
+        bufs[i].resize(old_size);
+    }
+    ssize_t res = ::readv(fd, iov.data(), num);
+    if (res <= 0) return res;
+    size_t left = res;
+    for (size_t i = 0; i < num && left > 0; ++i)
+    {
+        size_t got = nstd::min(left, iov[i].iov_len);
+        bufs[i].resize_for_overwrite(bufs[i].size() + got);
+        left -= got;
+    }
+    return res;
+}
+template <typename T>
+ssize_t nstd::write(int fd, const vector<T>& buf)
+{
+    static_assert(nstd::detail::is_byte_buffer_v<T>, "nstd::write requires a byte-sized trivially copyable type");
+    return ::write(fd, buf.data(), buf.size());
+}
+template <typename T>
+ssize_t nstd::pwrite(int fd, const vector<T>& buf, off_t offset)
+{
+    static_assert(nstd::detail::is_byte_buffer_v<T>, "nstd::pwrite requires a byte-sized trivially copyable type");
+    return ::pwrite(fd, buf.data(), buf.size(), offset);
+}
+template <typename T>
+ssize_t nstd::writev(int fd, const vector<T>* bufs, size_t num)
+{
+    static_assert(nstd::detail::is_byte_buffer_v<T>, "nstd::writev requires a byte-sized trivially copyable type");
+    vector<iovec> iov;
+    iov.resize_for_overwrite(num);
+    for (size_t i = 0; i < num; ++i)
+    {
+        iov[i].iov_base = const_cast<T*>(bufs[i].data());
+        iov[i].iov_len = bufs[i].size();
+    }
+    return ::writev(fd, iov.data(), num);
+}
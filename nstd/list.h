@@ -1,7 +1,14 @@
 #pragma once
 
+#include <functional>
+#include <iterator>
+#include <type_traits>
 #include <new>
 
+// Nodes are allocated one at a time, so after churn they end up scattered across the
+// heap. compact() moves them into a single block laid out in list order; nodes freed
+// from the block are kept on a free list and reused by later insertions.
+
 namespace nstd { template <typename T> class list; }
 
 template <typename T>
@@ -34,7 +41,7 @@ private:
 
         // Types
         typedef std::bidirectional_iterator_tag                                          iterator_category;
-        typedef value_type                                                               value_type;
+        typedef T                                                                        value_type;
         typedef typename std::conditional<Mutable, value_type&, const value_type&>::type reference;
         typedef typename std::conditional<Mutable, value_type*, const value_type*>::type pointer;
         typedef ptrdiff_t                                                                difference_type;
@@ -62,7 +69,7 @@ private:
 
         // Comparisons
         template<bool Mut2>
-        bool operator==(const iterator_t<Mut2>& other) const noexcept { cerr << "cmp" << endl; return ptr == other.ptr; }
+        bool operator==(const iterator_t<Mut2>& other) const noexcept { return ptr == other.ptr; }
         template<bool Mut2>
         bool operator!=(const iterator_t<Mut2>& other) const noexcept { return ptr != other.ptr; }
 
@@ -88,10 +95,14 @@ public:
     typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
     // Constructors
-    list() noexcept                      : size_(0) { new(&dummy) node{nullptr, &dummy, &dummy}; }
+    list() noexcept : size_(0), block_(nullptr), block_size_(0), free_(nullptr) { new(&dummy) node{nullptr, &dummy, &dummy}; }
 
     // Destructor
-    ~list()                                noexcept { while (size_ > 0) pop_back(); }
+    ~list() noexcept
+    {
+        while (size_ > 0) pop_back();
+        ::operator delete(block_);
+    }
 
     // Iterators
     iterator begin()                       noexcept { return iterator(dummy.next);       }
@@ -125,8 +136,57 @@ public:
     void pop_back()                                 { remove_node(dummy.prev);                 }
     void pop_front()                                { remove_node(dummy.next);                 }
 
+    // Relink all nodes, in list order, into one contiguous block. Values are not moved,
+    // so references and pointers to elements stay valid; iterators other than end() are
+    // invalidated.
+    void compact()
+    {
+        node* block = size_ > 0 ? static_cast<node*>(::operator new(size_ * sizeof(node))) : nullptr;
+        node* curr = dummy.next;
+        for (size_type i = 0; i < size_; ++i)
+        {
+            node* next = curr->next;
+            new(block + i) node{curr->val, i + 1 < size_ ? block + i + 1 : &dummy, i > 0 ? block + i - 1 : &dummy};
+            free_node(curr);
+            curr = next;
+        }
+        dummy.next = size_ > 0 ? block : &dummy;
+        dummy.prev = size_ > 0 ? block + size_ - 1 : &dummy;
+        ::operator delete(block_);
+        block_ = block;
+        block_size_ = size_;
+        free_ = nullptr;
+    }
+
+    // Apply fn to each element in order, prefetching the nodes and values a few steps
+    // ahead. fn may modify elements but not insert or remove them.
+    template <typename Func>
+    Func for_each(Func fn)
+    {
+        node* ahead = prefetch_from(dummy.next);
+        for (node* curr = dummy.next; curr != &dummy; curr = curr->next)
+        {
+            if (ahead != &dummy) ahead = prefetch(ahead);
+            fn(*curr->val);
+        }
+        return fn;
+    }
+    template <typename Func>
+    Func for_each(Func fn) const
+    {
+        node* ahead = prefetch_from(dummy.next);
+        for (const node* curr = dummy.next; curr != &dummy; curr = curr->next)
+        {
+            if (ahead != &dummy) ahead = prefetch(ahead);
+            fn(static_cast<const_reference>(*curr->val));
+        }
+        return fn;
+    }
+
 private:
 
+    static constexpr size_type prefetch_distance = 4;
+
     // Utility functions
     node* create_node(node* loc, const_reference val)
     {
@@ -139,7 +199,14 @@ private:
     node* create_node_only(node* loc, pointer val)
     {
         ++size_;
-        node* curr = new node{val, loc, loc->prev};
+        node* curr;
+        if (free_)
+        {
+            curr = free_;
+            free_ = free_->next;
+            new(curr) node{val, loc, loc->prev};
+        }
+        else curr = new node{val, loc, loc->prev};
         curr->prev->next = curr;
         curr->next->prev = curr;
         return curr;
@@ -150,9 +217,42 @@ private:
         curr->prev->next = curr->next;
         curr->next->prev = curr->prev;
         delete curr->val;
-        delete curr;
+        free_node(curr);
+    }
+    bool in_block(const node* curr) const noexcept
+    {
+        return !std::less<const node*>()(curr, block_) && std::less<const node*>()(curr, block_ + block_size_);
+    }
+    void free_node(node* curr) noexcept
+    {
+        if (!in_block(curr))
+        {
+            delete curr;
+            return;
+        }
+        curr->next = free_;
+        free_ = curr;
+    }
+
+    // Prefetching
+    node* prefetch_from(node* ahead) const noexcept
+    {
+        for (size_type i = 0; i < prefetch_distance && ahead != &dummy; ++i)
+            ahead = prefetch(ahead);
+        return ahead;
+    }
+    static node* prefetch(node* ahead) noexcept
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(ahead->next);
+        __builtin_prefetch(ahead->val);
+#endif
+        return ahead->next;
     }
 
     node dummy;
     size_type size_;
+    node* block_;
+    size_type block_size_;
+    node* free_;
 };
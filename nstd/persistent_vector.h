@@ -0,0 +1,424 @@
+#pragma once
+
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include "vector.h"
+
+// Immutable vector with structural sharing: a 32-way trie of reference-counted nodes
+// plus a tail leaf. Updates copy only the path to the changed leaf, so old versions stay
+// valid and can be read from other threads while new versions are built. A node whose
+// reference count is one belongs to a single version and is edited in place, which is
+// what the transient uses for cheap batch updates. Leaves hold their values inline.
+
+namespace nstd { template <typename T> class persistent_vector; }
+
+template <typename T>
+class nstd::persistent_vector
+{
+public:
+
+    // Types
+    typedef T                                     value_type;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+    typedef value_type*                           pointer;
+    typedef const value_type*                     const_pointer;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+    class transient;
+    class const_iterator;
+    typedef const_iterator                        iterator;
+
+    // Constructors
+    persistent_vector() noexcept : size_(0), shift_(bits), root_(nullptr), tail_(nullptr) {}
+    persistent_vector(const persistent_vector& other) noexcept
+        : size_(other.size_), shift_(other.shift_), root_(acquire(other.root_)), tail_(acquire(other.tail_)) {}
+    persistent_vector(persistent_vector&& other) noexcept : persistent_vector()
+    {
+        swap(other);
+    }
+    persistent_vector(std::initializer_list<value_type> vals) : persistent_vector()
+    {
+        for (const_reference val : vals) mutate_push_back(val);
+    }
+    persistent_vector(const vector<value_type>& vals) : persistent_vector()
+    {
+        for (const_reference val : vals) mutate_push_back(val);
+    }
+    persistent_vector(vector<value_type>&& vals) : persistent_vector()
+    {
+        for (reference val : vals) mutate_push_back(std::move(val));
+        vals.clear();
+    }
+
+    // Destructor
+    ~persistent_vector() noexcept
+    {
+        release(root_, shift_);
+        release(tail_, 0);
+    }
+
+    // Assignment
+    persistent_vector& operator=(persistent_vector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Iterators
+    const_iterator begin()           const noexcept { return const_iterator(this, 0);     }
+    const_iterator cbegin()          const noexcept { return const_iterator(this, 0);     }
+    const_iterator end()             const noexcept { return const_iterator(this, size_); }
+    const_iterator cend()            const noexcept { return const_iterator(this, size_); }
+
+    // Size
+    bool empty()                     const noexcept { return size_ == 0; }
+    size_type size()                 const noexcept { return size_;      }
+
+    // Element access
+    const_reference operator[](size_type idx) const { return leaf_for(idx)->vals()[idx & mask]; }
+    const_reference front()                   const { return (*this)[0];                      }
+    const_reference back()                    const { return (*this)[size_ - 1];              }
+    const_reference at(size_type idx)         const { if (idx >= size_) throw std::out_of_range("nstd::persistent_vector::at"); return (*this)[idx]; }
+
+    // Updates, each returning a new version
+    persistent_vector set(size_type idx, const_reference val) const
+    {
+        persistent_vector ret(*this);
+        ret.mutate_set(idx, val);
+        return ret;
+    }
+    persistent_vector push_back(const_reference val) const
+    {
+        persistent_vector ret(*this);
+        ret.mutate_push_back(val);
+        return ret;
+    }
+    persistent_vector pop_back() const
+    {
+        persistent_vector ret(*this);
+        ret.mutate_pop_back();
+        return ret;
+    }
+
+    // Conversions
+    transient as_transient() const
+    {
+        return transient(*this);
+    }
+    vector<value_type> to_vector() const
+    {
+        vector<value_type> ret;
+        ret.reserve(size_);
+        for (size_type idx = 0; idx < size_; idx += width)
+        {
+            const leaf* curr = leaf_for(idx);
+            ret.append_range(curr->vals(), curr->vals() + curr->count);
+        }
+        return ret;
+    }
+
+    void swap(persistent_vector& other) noexcept
+    {
+        std::swap(size_, other.size_);
+        std::swap(shift_, other.shift_);
+        std::swap(root_, other.root_);
+        std::swap(tail_, other.tail_);
+    }
+
+private:
+
+    static constexpr size_type bits  = 5;
+    static constexpr size_type width = size_type(1) << bits;
+    static constexpr size_type mask  = width - 1;
+
+    // Nodes
+    struct node
+    {
+        node() noexcept : refs(1) {}
+        std::atomic<size_type> refs;
+    };
+    struct branch : node
+    {
+        node* child[width] = {};
+    };
+    struct leaf : node
+    {
+        leaf() noexcept : count(0) {}
+        leaf(const leaf& other) : leaf()
+        {
+            for (; count < other.count; ++count)
+                new(vals() + count) value_type(other.vals()[count]);
+        }
+        ~leaf() noexcept { nstd::destruct(vals(), vals() + count); }
+
+        pointer vals()                         noexcept { return reinterpret_cast<pointer>(storage);       }
+        const_pointer vals()             const noexcept { return reinterpret_cast<const_pointer>(storage); }
+        template <typename U>
+        void push_back(U&& val)                         { new(vals() + count) value_type(std::forward<U>(val)); ++count; }
+        void pop_back()                        noexcept { vals()[--count].~value_type();                      }
+
+        size_type count;
+        typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type storage[width];
+    };
+
+    // Reference counting
+    static node* acquire(node* curr) noexcept
+    {
+        if (curr) curr->refs.fetch_add(1, std::memory_order_relaxed);
+        return curr;
+    }
+    static leaf* acquire(leaf* curr) noexcept
+    {
+        return static_cast<leaf*>(acquire(static_cast<node*>(curr)));
+    }
+    static branch* acquire(branch* curr) noexcept
+    {
+        return static_cast<branch*>(acquire(static_cast<node*>(curr)));
+    }
+    static void release(node* curr, size_type level) noexcept
+    {
+        if (!curr || curr->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        if (level == 0)
+        {
+            delete static_cast<leaf*>(curr);
+            return;
+        }
+        branch* br = static_cast<branch*>(curr);
+        for (node* child : br->child)
+            release(child, level - bits);
+        delete br;
+    }
+
+    // Copy-on-write; each takes ownership of one reference and returns an owned node
+    static bool unique(node* curr) noexcept
+    {
+        return curr->refs.load(std::memory_order_acquire) == 1;
+    }
+    static leaf* edit_leaf(leaf* curr)
+    {
+        if (unique(curr)) return curr;
+        leaf* ret = new leaf(*curr);
+        release(curr, 0);
+        return ret;
+    }
+    static branch* edit_branch(branch* curr, size_type level)
+    {
+        if (unique(curr)) return curr;
+        branch* ret = new branch;
+        for (size_type i = 0; i < width; ++i)
+            ret->child[i] = acquire(curr->child[i]);
+        release(curr, level);
+        return ret;
+    }
+
+    // Utility functions
+    size_type tail_offset() const noexcept
+    {
+        return size_ < width ? 0 : ((size_ - 1) >> bits) << bits;
+    }
+    const leaf* leaf_for(size_type idx) const noexcept
+    {
+        if (idx >= tail_offset()) return tail_;
+        const node* curr = root_;
+        for (size_type level = shift_; level > 0; level -= bits)
+            curr = static_cast<const branch*>(curr)->child[(idx >> level) & mask];
+        return static_cast<const leaf*>(curr);
+    }
+    static node* new_path(size_type level, node* curr)
+    {
+        if (level == 0) return curr;
+        branch* ret = new branch;
+        ret->child[0] = new_path(level - bits, curr);
+        return ret;
+    }
+    branch* push_tail(size_type level, branch* parent, leaf* full)
+    {
+        branch* ret = parent ? edit_branch(parent, level) : new branch;
+        size_type sub = ((size_ - 1) >> level) & mask;
+        node* child = ret->child[sub];
+        if (level == bits) ret->child[sub] = full;
+        else if (child)    ret->child[sub] = push_tail(level - bits, static_cast<branch*>(child), full);
+        else               ret->child[sub] = new_path(level - bits, full);
+        return ret;
+    }
+    branch* pop_tail(size_type level, branch* parent)
+    {
+        branch* ret = edit_branch(parent, level);
+        size_type sub = ((size_ - 2) >> level) & mask;
+        if (level > bits)
+        {
+            ret->child[sub] = pop_tail(level - bits, static_cast<branch*>(ret->child[sub]));
+            if (ret->child[sub] || sub != 0) return ret;
+        }
+        else if (sub != 0)
+        {
+            release(ret->child[sub], 0);
+            ret->child[sub] = nullptr;
+            return ret;
+        }
+        release(ret, level);
+        return nullptr;
+    }
+    node* set_in(size_type level, node* curr, size_type idx, const_reference val)
+    {
+        if (level == 0)
+        {
+            leaf* ret = edit_leaf(static_cast<leaf*>(curr));
+            ret->vals()[idx & mask] = val;
+            return ret;
+        }
+        branch* ret = edit_branch(static_cast<branch*>(curr), level);
+        size_type sub = (idx >> level) & mask;
+        ret->child[sub] = set_in(level - bits, ret->child[sub], idx, val);
+        return ret;
+    }
+
+    // In-place updates, copying only shared nodes
+    void mutate_set(size_type idx, const_reference val)
+    {
+        if (idx >= tail_offset())
+        {
+            tail_ = edit_leaf(tail_);
+            tail_->vals()[idx & mask] = val;
+        }
+        else root_ = static_cast<branch*>(set_in(shift_, root_, idx, val));
+    }
+    template <typename U>
+    void mutate_push_back(U&& val)
+    {
+        if (size_ - tail_offset() == width)
+        {
+            if ((size_ >> bits) > (size_type(1) << shift_))
+            {
+                branch* ret = new branch;
+                ret->child[0] = root_;
+                ret->child[1] = new_path(shift_, tail_);
+                root_ = ret;
+                shift_ += bits;
+            }
+            else root_ = push_tail(shift_, root_, tail_);
+            tail_ = nullptr;
+        }
+        tail_ = tail_ ? edit_leaf(tail_) : new leaf;
+        tail_->push_back(std::forward<U>(val));
+        ++size_;
+    }
+    void mutate_pop_back()
+    {
+        if (size_ - tail_offset() > 1)
+        {
+            tail_ = edit_leaf(tail_);
+            tail_->pop_back();
+            --size_;
+            return;
+        }
+        if (size_ == 1)
+        {
+            persistent_vector().swap(*this);
+            return;
+        }
+        leaf* new_tail = acquire(const_cast<leaf*>(leaf_for(size_ - 2)));
+        root_ = pop_tail(shift_, root_);
+        release(tail_, 0);
+        tail_ = new_tail;
+        if (shift_ > bits && !root_->child[1])
+        {
+            branch* old_root = root_;
+            root_ = acquire(static_cast<branch*>(old_root->child[0]));
+            release(old_root, shift_);
+            shift_ -= bits;
+        }
+        --size_;
+    }
+
+    size_type size_;
+    size_type shift_;
+    branch* root_;
+    leaf* tail_;
+};
+
+template <typename T>
+class nstd::persistent_vector<T>::const_iterator
+{
+public:
+
+    // Types
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T                         value_type;
+    typedef const T&                  reference;
+    typedef const T*                  pointer;
+    typedef ptrdiff_t                 difference_type;
+
+    // Constructors
+    const_iterator() noexcept : vec(nullptr), idx(0), vals(nullptr) {}
+
+    // Access
+    reference operator*() const { return vals[idx & mask];  }
+    pointer operator->()  const { return &vals[idx & mask]; }
+
+    // Iteration
+    const_iterator& operator++()    noexcept { ++idx; load(); return *this; }
+    const_iterator operator++(int)  noexcept { const_iterator temp = *this; ++*this; return temp; }
+
+    // Comparisons
+    bool operator==(const const_iterator& other) const noexcept { return idx == other.idx; }
+    bool operator!=(const const_iterator& other) const noexcept { return idx != other.idx; }
+
+private:
+
+    // Internal constructor
+    const_iterator(const persistent_vector* vec, size_type idx) noexcept : vec(vec), idx(idx), vals(nullptr)
+    {
+        if (idx < vec->size_) vals = vec->leaf_for(idx)->vals();
+    }
+
+    // Fetch the next leaf when crossing a leaf boundary
+    void load() noexcept
+    {
+        if ((idx & mask) == 0 && idx < vec->size_) vals = vec->leaf_for(idx)->vals();
+    }
+
+    const persistent_vector* vec;
+    size_type idx;
+    const T* vals;
+
+    friend class persistent_vector;
+};
+
+template <typename T>
+class nstd::persistent_vector<T>::transient
+{
+public:
+
+    // Constructors
+    transient() noexcept {}
+    explicit transient(const persistent_vector& vec) noexcept : vec_(vec) {}
+
+    // Size
+    bool empty()                     const noexcept { return vec_.empty(); }
+    size_type size()                 const noexcept { return vec_.size();  }
+
+    // Element access
+    const_reference operator[](size_type idx) const { return vec_[idx];    }
+
+    // Modifiers
+    transient& set(size_type idx, const_reference val) { vec_.mutate_set(idx, val);                 return *this; }
+    transient& push_back(const_reference val)          { vec_.mutate_push_back(val);                return *this; }
+    transient& push_back(value_type&& val)             { vec_.mutate_push_back(std::move(val));     return *this; }
+    transient& pop_back()                              { vec_.mutate_pop_back();                    return *this; }
+
+    // Freeze the batch; the transient is left empty
+    persistent_vector persistent() noexcept
+    {
+        return std::move(vec_);
+    }
+
+private:
+
+    persistent_vector vec_;
+};
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include "vector.h"
+#include "list.h"
+#include "span.h"
+
+// Binary layout (native byte order):
+//   header   "NSTD" magic, uint16_t version, uint16_t byte order mark
+//   scalar   raw bytes, aligned to alignof(T) relative to the start of the buffer
+//   sequence uint64_t count, then the elements; trivially copyable elements are
+//            stored contiguously and aligned, anything else is written recursively
+// nstd::vector and nstd::list share the sequence encoding, so either can be read as the other.
+// Alignment is relative to the header, which the writer places at an offset into its buffer
+// that is a multiple of alignof(std::max_align_t). For view() the reader's buffer must start
+// at the header and be aligned to alignof(std::max_align_t), as nstd::vector storage is.
+
+namespace nstd
+{
+    class binary_writer;
+    class binary_reader;
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr bool is_raw_serializable_v = std::is_trivially_copyable<T>::value;
+    }
+
+    constexpr char binary_magic[4] = {'N', 'S', 'T', 'D'};
+    constexpr uint16_t binary_version = 1;
+    constexpr uint16_t binary_byte_order = 0x0102;
+}
+
+class nstd::binary_writer
+{
+public:
+
+    // Constructors
+    binary_writer(vector<char>& out) : out_(out), base_(0)
+    {
+        align(alignof(std::max_align_t));
+        base_ = out_.size();
+        write_bytes(binary_magic, sizeof(binary_magic));
+        write(binary_version);
+        write(binary_byte_order);
+    }
+
+    // Offset of the header in the output buffer
+    size_t offset()                  const noexcept { return base_; }
+
+    // Writing
+    template <typename T, typename = std::enable_if_t<detail::is_raw_serializable_v<T>>>
+    void write(const T& val)
+    {
+        align(alignof(T));
+        write_bytes(&val, sizeof(T));
+    }
+    template <typename T>
+    void write(const vector<T>& vals)
+    {
+        begin_sequence<T>(vals.size());
+        if (detail::is_raw_serializable_v<T>)
+            write_bytes(vals.data(), vals.size() * sizeof(T));
+        else
+            for (const T& val : vals) write(val);
+    }
+    template <typename T>
+    void write(const list<T>& vals)
+    {
+        begin_sequence<T>(vals.size());
+        for (auto it = vals.begin(); it != vals.end(); ++it)
+            write(*it);
+    }
+
+private:
+
+    // Utility functions
+    template <typename T>
+    void begin_sequence(size_t cnt)
+    {
+        write(uint64_t(cnt));
+        if (detail::is_raw_serializable_v<T>) align(alignof(T));
+    }
+    void align(size_t alignment)
+    {
+        size_t pad = (alignment - (out_.size() - base_) % alignment) % alignment;
+        out_.resize(out_.size() + pad, 0);
+    }
+    void write_bytes(const void* src, size_t cnt)
+    {
+        if (cnt == 0) return;
+        size_t old_size = out_.size();
+        out_.resize_for_overwrite(old_size + cnt);
+        std::memcpy(out_.data() + old_size, src, cnt);
+    }
+
+    vector<char>& out_;
+    size_t base_;
+};
+
+class nstd::binary_reader
+{
+public:
+
+    // Constructors
+    binary_reader(const char* data, size_t cnt) : data_(data), size_(cnt), pos_(0)
+    {
+        char magic[sizeof(binary_magic)];
+        read_bytes(magic, sizeof(magic));
+        if (std::memcmp(magic, binary_magic, sizeof(magic)) != 0)
+            throw std::runtime_error("nstd::binary_reader: bad magic");
+        if (read<uint16_t>() != binary_version)
+            throw std::runtime_error("nstd::binary_reader: unsupported version");
+        if (read<uint16_t>() != binary_byte_order)
+            throw std::runtime_error("nstd::binary_reader: byte order mismatch");
+    }
+    binary_reader(span<const char> buf) : binary_reader(buf.data(), buf.size()) {}
+
+    // Position
+    bool done()                      const noexcept { return pos_ == size_; }
+    size_t position()                const noexcept { return pos_;          }
+
+    // Reading
+    template <typename T, typename = std::enable_if_t<detail::is_raw_serializable_v<T>>>
+    T read()
+    {
+        T val;
+        align(alignof(T));
+        read_bytes(&val, sizeof(T));
+        return val;
+    }
+    template <typename T, typename = std::enable_if_t<detail::is_raw_serializable_v<T>>>
+    void read(T& val)
+    {
+        val = read<T>();
+    }
+    template <typename T>
+    void read(vector<T>& vals)
+    {
+        size_t cnt = begin_sequence<T>();
+        size_t old_size = vals.size();
+        if (detail::is_raw_serializable_v<T>)
+        {
+            vals.resize_for_overwrite(old_size + cnt);
+            read_bytes(vals.data() + old_size, cnt * sizeof(T));
+        }
+        else
+        {
+            vals.reserve(old_size + cnt);
+            while (cnt-- > 0)
+                read(vals.emplace_back());
+        }
+    }
+    template <typename T>
+    void read(list<T>& vals)
+    {
+        size_t cnt = begin_sequence<T>();
+        while (cnt-- > 0)
+        {
+            T val;
+            read(val);
+            vals.push_back(std::move(val));
+        }
+    }
+
+    // Zero-copy access; the returned span points into the reader's buffer
+    size_t read_size()
+    {
+        return read<uint64_t>();
+    }
+    template <typename T>
+    span<const T> view()
+    {
+        static_assert(detail::is_raw_serializable_v<T>, "nstd::binary_reader::view requires a trivially copyable type");
+        size_t cnt = begin_sequence<T>();
+        if (reinterpret_cast<uintptr_t>(data_ + pos_) % alignof(T) != 0)
+            throw std::runtime_error("nstd::binary_reader: misaligned buffer");
+        const T* first = reinterpret_cast<const T*>(data_ + pos_);
+        pos_ += cnt * sizeof(T);
+        return span<const T>(first, cnt);
+    }
+
+private:
+
+    // Utility functions
+    template <typename T>
+    size_t begin_sequence()
+    {
+        size_t cnt = read_size();
+        if (!detail::is_raw_serializable_v<T>)
+        {
+            // Non-raw elements are sequences, each taking at least its own count
+            if (cnt > (size_ - pos_) / sizeof(uint64_t))
+                throw std::out_of_range("nstd::binary_reader: truncated input");
+            return cnt;
+        }
+        align(alignof(T));
+        if (cnt > (size_ - pos_) / sizeof(T))
+            throw std::out_of_range("nstd::binary_reader: truncated input");
+        return cnt;
+    }
+    void align(size_t alignment)
+    {
+        pos_ = nstd::min(size_, pos_ + (alignment - pos_ % alignment) % alignment);
+    }
+    void read_bytes(void* dst, size_t cnt)
+    {
+        if (cnt > size_ - pos_)
+            throw std::out_of_range("nstd::binary_reader: truncated input");
+        if (cnt == 0) return;
+        std::memcpy(dst, data_ + pos_, cnt);
+        pos_ += cnt;
+    }
+
+    const char* data_;
+    size_t size_;
+    size_t pos_;
+};
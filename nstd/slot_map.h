@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include "vector.h"
+
+// Values are kept densely packed in insertion/swap order; keys go through a slot table
+// that maps them to the current dense index. Erasing moves the last value into the
+// hole and bumps the slot's generation, so keys to erased values stop resolving.
+
+namespace nstd { template <typename T> class slot_map; }
+
+template <typename T>
+class nstd::slot_map
+{
+public:
+
+    // Types
+    typedef T                                     value_type;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+    typedef value_type&&                          rvalue_reference;
+    typedef value_type*                           pointer;
+    typedef const value_type*                     const_pointer;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+    typedef value_type*                           iterator;
+    typedef const value_type*                     const_iterator;
+
+    struct key
+    {
+        uint32_t index;
+        uint32_t generation;
+
+        bool operator==(const key& other) const noexcept { return index == other.index && generation == other.generation; }
+        bool operator!=(const key& other) const noexcept { return !(*this == other); }
+    };
+
+    // Constructors
+    slot_map() noexcept : free_head_(npos) {}
+
+    // Iterators
+    iterator begin()                       noexcept { return values_.begin(); }
+    const_iterator begin()           const noexcept { return values_.begin(); }
+    const_iterator cbegin()          const noexcept { return values_.begin(); }
+    iterator end()                         noexcept { return values_.end();   }
+    const_iterator end()             const noexcept { return values_.end();   }
+    const_iterator cend()            const noexcept { return values_.end();   }
+
+    // Size
+    bool empty()                     const noexcept { return values_.empty();    }
+    size_type size()                 const noexcept { return values_.size();     }
+    size_type capacity()             const noexcept { return values_.capacity(); }
+    void reserve(size_type cnt)
+    {
+        values_.reserve(cnt);
+        dense_slots_.reserve(cnt);
+        slots_.reserve(cnt);
+    }
+
+    // Lookup
+    bool contains(key k)             const noexcept { return k.index < slots_.size() && slots_[k.index].generation == k.generation; }
+    pointer find(key k)                    noexcept { return contains(k) ? &values_[slots_[k.index].target] : nullptr; }
+    const_pointer find(key k)        const noexcept { return contains(k) ? &values_[slots_[k.index].target] : nullptr; }
+    reference operator[](key k)                     { return values_[slots_[k.index].target];   }
+    const_reference operator[](key k)         const { return values_[slots_[k.index].target];   }
+    reference at(key k)                             { if (!contains(k)) throw std::out_of_range("nstd::slot_map::at"); return (*this)[k]; }
+    const_reference at(key k)                 const { if (!contains(k)) throw std::out_of_range("nstd::slot_map::at"); return (*this)[k]; }
+    key key_of(const_iterator pos)   const noexcept
+    {
+        uint32_t index = dense_slots_[pos - begin()];
+        return key{index, slots_[index].generation};
+    }
+
+    // Modifiers
+    key insert(const_reference val)                 { return emplace(val);            }
+    key insert(rvalue_reference val)                { return emplace(std::move(val)); }
+    // The value is built before any storage grows, since args may refer into values_,
+    // and each step that can throw leaves the map consistent
+    template <typename... Args>
+    key emplace(Args&&... args)
+    {
+        value_type val(std::forward<Args>(args)...);
+        if (free_head_ == npos)
+        {
+            slots_.push_back(slot{npos, 0});
+            free_head_ = slots_.size() - 1;
+        }
+        uint32_t index = free_head_;
+        dense_slots_.push_back(index);
+        try
+        {
+            values_.push_back(std::move(val));
+        }
+        catch (...)
+        {
+            dense_slots_.pop_back();
+            throw;
+        }
+        free_head_ = slots_[index].target;
+        slots_[index].target = values_.size() - 1;
+        return key{index, slots_[index].generation};
+    }
+    bool erase(key k)
+    {
+        if (!contains(k)) return false;
+        erase_dense(slots_[k.index].target);
+        return true;
+    }
+    iterator erase(const_iterator pos)
+    {
+        difference_type offset = pos - begin();
+        erase_dense(offset);
+        return begin() + offset;
+    }
+    void clear() noexcept
+    {
+        for (iterator it = begin(); it != end(); ++it)
+            release_slot(dense_slots_[it - begin()]);
+        values_.clear();
+        dense_slots_.clear();
+    }
+    void swap(slot_map& other) noexcept
+    {
+        values_.swap(other.values_);
+        dense_slots_.swap(other.dense_slots_);
+        slots_.swap(other.slots_);
+        std::swap(free_head_, other.free_head_);
+    }
+
+private:
+
+    static constexpr uint32_t npos = uint32_t(-1);
+
+    // Occupied slots hold a dense index, free slots the next free slot
+    struct slot
+    {
+        uint32_t target;
+        uint32_t generation;
+    };
+
+    // Utility functions
+    void erase_dense(size_type idx)
+    {
+        size_type last = values_.size() - 1;
+        uint32_t index = dense_slots_[idx];
+        if (idx != last)
+        {
+            values_[idx] = std::move(values_[last]);
+            dense_slots_[idx] = dense_slots_[last];
+            slots_[dense_slots_[idx]].target = idx;
+        }
+        values_.pop_back();
+        dense_slots_.pop_back();
+        release_slot(index);
+    }
+    void release_slot(uint32_t index) noexcept
+    {
+        ++slots_[index].generation;
+        slots_[index].target = free_head_;
+        free_head_ = index;
+    }
+
+    vector<value_type> values_;
+    vector<uint32_t> dense_slots_;
+    vector<slot> slots_;
+    uint32_t free_head_;
+};
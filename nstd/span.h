@@ -0,0 +1,59 @@
+#pragma once
+
+#include <iterator>
+#include <stdexcept>
+
+namespace nstd { template <typename T> class span; }
+
+template <typename T>
+class nstd::span
+{
+public:
+
+    // Types
+    typedef T                                     element_type;
+    typedef typename std::remove_cv<T>::type      value_type;
+    typedef element_type&                         reference;
+    typedef const element_type&                   const_reference;
+    typedef element_type*                         pointer;
+    typedef const element_type*                   const_pointer;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+    typedef element_type*                         iterator;
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+
+    // Constructors
+    constexpr span()                               noexcept : data_(nullptr), size_(0) {}
+    constexpr span(pointer data, size_type cnt)    noexcept : data_(data), size_(cnt)  {}
+    constexpr span(pointer first, pointer last)    noexcept : data_(first), size_(last - first) {}
+    template <typename Container, typename = decltype(std::declval<Container&>().data())>
+    constexpr span(Container& other)               noexcept : data_(other.data()), size_(other.size()) {}
+
+    // Iterators
+    constexpr iterator begin()               const noexcept { return data_;         }
+    constexpr iterator end()                 const noexcept { return data_ + size_; }
+    reverse_iterator rbegin()                const noexcept { return reverse_iterator(data_ + size_); }
+    reverse_iterator rend()                  const noexcept { return reverse_iterator(data_);         }
+
+    // Size
+    constexpr bool empty()                   const noexcept { return size_ == 0;                }
+    constexpr size_type size()               const noexcept { return size_;                     }
+    constexpr size_type size_bytes()         const noexcept { return size_ * sizeof(element_type); }
+
+    // Element access
+    constexpr reference operator[](size_type idx)     const { return data_[idx];       }
+    constexpr reference front()                       const { return data_[0];         }
+    constexpr reference back()                        const { return data_[size_ - 1]; }
+    constexpr pointer data()                 const noexcept { return data_;            }
+    reference at(size_type idx)                       const { if (idx >= size_) throw std::out_of_range("nstd::span::at"); return data_[idx]; }
+
+    // Subviews
+    constexpr span first(size_type cnt)               const { return span(data_, cnt);                  }
+    constexpr span last(size_type cnt)                const { return span(data_ + size_ - cnt, cnt);    }
+    constexpr span subspan(size_type idx, size_type cnt) const { return span(data_ + idx, cnt);         }
+
+private:
+
+    pointer data_;
+    size_type size_;
+};
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include "vector.h"
+
+// Strings of up to local_capacity chars live inline; longer ones are kept in an
+// nstd::vector<char> that also holds the terminating null, so growth follows the
+// vector's policy. Searching and comparison go through memchr/memcmp.
+
+namespace nstd
+{
+    class string;
+
+    bool operator==(const string&, const string&) noexcept;
+    bool operator==(const string&, const char*) noexcept;
+    bool operator!=(const string&, const string&) noexcept;
+    bool operator!=(const string&, const char*) noexcept;
+    bool operator<(const string&, const string&) noexcept;
+    bool operator<=(const string&, const string&) noexcept;
+    bool operator>(const string&, const string&) noexcept;
+    bool operator>=(const string&, const string&) noexcept;
+
+    string operator+(const string&, const string&);
+    string operator+(const string&, const char*);
+}
+
+class nstd::string
+{
+public:
+
+    // Types
+    typedef char                                  value_type;
+    typedef char&                                 reference;
+    typedef const char&                           const_reference;
+    typedef char*                                 pointer;
+    typedef const char*                           const_pointer;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+    typedef char*                                 iterator;
+    typedef const char*                           const_iterator;
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    static constexpr size_type npos = size_type(-1);
+    static constexpr size_type local_capacity = sizeof(vector<char>) - 1;
+
+    // Constructors
+    string() noexcept : local_size_(0) { local_[0] = '\0'; }
+    string(const char* str) : string() { append(str, std::strlen(str)); }
+    string(const char* str, size_type cnt) : string() { append(str, cnt); }
+    string(size_type cnt, char ch) : string() { std::memset(grow(cnt), ch, cnt); }
+    string(const string& other) : string() { append(other.data(), other.size()); }
+    string(string&& other) noexcept : string() { swap(other); }
+
+    // Destructor
+    ~string() noexcept
+    {
+        if (is_long()) heap_.~vector();
+    }
+
+    // Assignment
+    string& operator=(const string& other)
+    {
+        if (this != &other) assign(other.data(), other.size());
+        return *this;
+    }
+    string& operator=(string&& other) noexcept
+    {
+        if (this == &other) return *this;
+        clear();
+        swap(other);
+        return *this;
+    }
+    string& operator=(const char* str)
+    {
+        return assign(str, std::strlen(str));
+    }
+    string& assign(const char* str, size_type cnt)
+    {
+        if (str >= begin() && str < end())
+        {
+            string temp(str, cnt);
+            swap(temp);
+            return *this;
+        }
+        clear();
+        return append(str, cnt);
+    }
+
+    // Iterators
+    iterator begin()                       noexcept { return data();          }
+    const_iterator begin()           const noexcept { return data();          }
+    const_iterator cbegin()          const noexcept { return data();          }
+    iterator end()                         noexcept { return data() + size(); }
+    const_iterator end()             const noexcept { return data() + size(); }
+    const_iterator cend()            const noexcept { return data() + size(); }
+    reverse_iterator rbegin()              noexcept { return reverse_iterator(end());         }
+    const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end());   }
+    reverse_iterator rend()                noexcept { return reverse_iterator(begin());       }
+    const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+
+    // Size
+    bool empty()                     const noexcept { return size() == 0;                                   }
+    size_type size()                 const noexcept { return is_long() ? heap_.size() - 1 : local_size_;     }
+    size_type length()               const noexcept { return size();                                        }
+    size_type capacity()             const noexcept { return is_long() ? heap_.capacity() - 1 : local_capacity; }
+    void reserve(size_type cnt)
+    {
+        if (cnt <= capacity()) return;
+        if (is_long()) heap_.reserve(cnt + 1);
+        else to_heap(cnt);
+    }
+
+    // Element access
+    reference operator[](size_type idx)             { return data()[idx];          }
+    const_reference operator[](size_type idx) const { return data()[idx];          }
+    reference front()                               { return data()[0];            }
+    const_reference front()                   const { return data()[0];            }
+    reference back()                                { return data()[size() - 1];   }
+    const_reference back()                    const { return data()[size() - 1];   }
+    pointer data()                         noexcept { return is_long() ? heap_.data() : local_; }
+    const_pointer data()             const noexcept { return is_long() ? heap_.data() : local_; }
+    const_pointer c_str()            const noexcept { return data();               }
+    reference at(size_type idx)                     { if (idx >= size()) throw std::out_of_range("nstd::string::at"); return data()[idx]; }
+    const_reference at(size_type idx)         const { if (idx >= size()) throw std::out_of_range("nstd::string::at"); return data()[idx]; }
+
+    // Modifiers
+    void clear()                           noexcept { grow(0);                          }
+    void push_back(char ch)                         { size_type old = size(); grow(old + 1)[old] = ch; }
+    void pop_back()                                 { grow(size() - 1);                 }
+    void resize(size_type cnt, char ch = '\0')
+    {
+        size_type old = size();
+        char* vals = grow(cnt);
+        if (cnt > old) std::memset(vals + old, ch, cnt - old);
+    }
+    string& append(const char* str, size_type cnt)
+    {
+        size_type old = size();
+        difference_type offset = str - data();
+        bool inside = str >= begin() && str < end();
+        char* vals = grow(old + cnt);
+        if (inside) str = vals + offset;
+        if (cnt > 0) std::memcpy(vals + old, str, cnt);
+        return *this;
+    }
+    string& append(const char* str)                 { return append(str, std::strlen(str));         }
+    string& append(const string& other)             { return append(other.data(), other.size());    }
+    string& operator+=(const string& other)         { return append(other.data(), other.size());    }
+    string& operator+=(const char* str)             { return append(str, std::strlen(str));         }
+    string& operator+=(char ch)                     { push_back(ch); return *this;                  }
+    void swap(string& other) noexcept
+    {
+        if (is_long() && other.is_long()) { heap_.swap(other.heap_); return; }
+        if (!is_long() && !other.is_long())
+        {
+            char temp[local_capacity + 1];
+            std::memcpy(temp, local_, local_capacity + 1);
+            std::memcpy(local_, other.local_, local_capacity + 1);
+            std::memcpy(other.local_, temp, local_capacity + 1);
+            std::swap(local_size_, other.local_size_);
+            return;
+        }
+        string& lng = is_long() ? *this : other;
+        string& shrt = is_long() ? other : *this;
+        vector<char> temp(std::move(lng.heap_));
+        lng.heap_.~vector();
+        std::memcpy(lng.local_, shrt.local_, local_capacity + 1);
+        lng.local_size_ = shrt.local_size_;
+        new(&shrt.heap_) vector<char>(std::move(temp));
+        shrt.local_size_ = long_tag;
+    }
+
+    // Operations
+    string substr(size_type pos = 0, size_type cnt = npos) const
+    {
+        if (pos > size()) throw std::out_of_range("nstd::string::substr");
+        return string(data() + pos, nstd::min(cnt, size() - pos));
+    }
+    int compare(const char* str, size_type cnt) const noexcept
+    {
+        size_type len = size();
+        int res = std::memcmp(data(), str, nstd::min(len, cnt));
+        if (res != 0) return res;
+        return len < cnt ? -1 : len > cnt ? 1 : 0;
+    }
+    int compare(const string& other)          const noexcept { return compare(other.data(), other.size()); }
+    int compare(const char* str)              const noexcept { return compare(str, std::strlen(str));       }
+
+    // Search
+    size_type find(char ch, size_type pos = 0) const noexcept
+    {
+        if (pos >= size()) return npos;
+        const void* res = std::memchr(data() + pos, ch, size() - pos);
+        return res ? static_cast<const char*>(res) - data() : npos;
+    }
+    size_type find(const char* str, size_type pos, size_type cnt) const noexcept
+    {
+        size_type len = size();
+        if (pos > len || cnt > len - pos) return npos;
+        if (cnt == 0) return pos;
+        const char* first = data() + pos;
+        const char* last = data() + len - cnt + 1;
+        while (first < last)
+        {
+            first = static_cast<const char*>(std::memchr(first, str[0], last - first));
+            if (!first) return npos;
+            if (std::memcmp(first + 1, str + 1, cnt - 1) == 0) return first - data();
+            ++first;
+        }
+        return npos;
+    }
+    size_type find(const char* str, size_type pos = 0)   const noexcept { return find(str, pos, std::strlen(str));         }
+    size_type find(const string& other, size_type pos = 0) const noexcept { return find(other.data(), pos, other.size()); }
+
+private:
+
+    static constexpr unsigned char long_tag = 0xFF;
+
+    // Utility functions
+    bool is_long() const noexcept { return local_size_ == long_tag; }
+    void to_heap(size_type cnt)
+    {
+        vector<char> vals;
+        vals.reserve(cnt + 1);
+        vals.resize_for_overwrite(local_size_ + 1);
+        std::memcpy(vals.data(), local_, local_size_ + 1);
+        new(&heap_) vector<char>(std::move(vals));
+        local_size_ = long_tag;
+    }
+
+    // Set the size to cnt keeping the contents; new chars are left uninitialized
+    char* grow(size_type cnt)
+    {
+        if (!is_long())
+        {
+            if (cnt <= local_capacity)
+            {
+                local_size_ = cnt;
+                local_[cnt] = '\0';
+                return local_;
+            }
+            to_heap(nstd::max(cnt, 2 * local_capacity));
+        }
+        heap_.resize_for_overwrite(cnt + 1);
+        heap_[cnt] = '\0';
+        return heap_.data();
+    }
+
+    union
+    {
+        vector<char> heap_;
+        char local_[local_capacity + 1];
+    };
+    unsigned char local_size_;
+};
+
+inline bool nstd::operator==(const string& lhs, const string& rhs) noexcept
+{
+    return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+}
+inline bool nstd::operator==(const string& lhs, const char* rhs) noexcept
+{
+    return lhs.compare(rhs) == 0;
+}
+inline bool nstd::operator!=(const string& lhs, const string& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+inline bool nstd::operator!=(const string& lhs, const char* rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+inline bool nstd::operator<(const string& lhs, const string& rhs) noexcept
+{
+    return lhs.compare(rhs) < 0;
+}
+inline bool nstd::operator<=(const string& lhs, const string& rhs) noexcept
+{
+    return lhs.compare(rhs) <= 0;
+}
+inline bool nstd::operator>(const string& lhs, const string& rhs) noexcept
+{
+    return lhs.compare(rhs) > 0;
+}
+inline bool nstd::operator>=(const string& lhs, const string& rhs) noexcept
+{
+    return lhs.compare(rhs) >= 0;
+}
+inline nstd::string nstd::operator+(const string& lhs, const string& rhs)
+{
+    string ret;
+    ret.reserve(lhs.size() + rhs.size());
+    return std::move(ret.append(lhs).append(rhs));
+}
+inline nstd::string nstd::operator+(const string& lhs, const char* rhs)
+{
+    size_t cnt = std::strlen(rhs);
+    string ret;
+    ret.reserve(lhs.size() + cnt);
+    return std::move(ret.append(lhs).append(rhs, cnt));
+}
+
+namespace std
+{
+    template <>
+    struct hash<nstd::string>
+    {
+        size_t operator()(const nstd::string& str) const noexcept
+        {
+            return std::hash<std::string_view>()(std::string_view(str.data(), str.size()));
+        }
+    };
+}
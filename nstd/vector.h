@@ -55,7 +55,7 @@ public:
     template <typename InputIter, typename = std::_RequireInputIter<InputIter>>
     vector(InputIter first, InputIter last) : vector()
     {
-        nstd::copy(first, last, std::back_insert_iterator<vector>(*this));
+        append_range(first, last, iterator_category<InputIter>());
     }
 
     // Destructor
@@ -96,7 +96,7 @@ public:
     void assign(InputIter first, InputIter last)
     {
         clear();
-        nstd::copy(first, last, std::back_insert_iterator<vector>(*this));
+        append_range(first, last, iterator_category<InputIter>());
     }
 
     // Iterators
@@ -167,9 +167,17 @@ public:
     template <typename InputIter, typename = std::_RequireInputIter<InputIter>>
     iterator insert(const_iterator pos, InputIter first, InputIter last)
     {
-        difference_type offset = pos - begin();
-        nstd::copy(first, last, std::insert_iterator<vector>(*this, iter_at(offset)));
-        return iter_at(offset);
+        return insert_range(pos - begin(), first, last, iterator_category<InputIter>());
+    }
+    template <typename InputIter, typename = std::_RequireInputIter<InputIter>>
+    void append_range(InputIter first, InputIter last)
+    {
+        append_range(first, last, iterator_category<InputIter>());
+    }
+    template <typename Range>
+    void append_range(const Range& vals)
+    {
+        append_range(std::begin(vals), std::end(vals));
     }
     template <typename... Args>
     iterator emplace(const_iterator pos, Args&&... args)
@@ -224,6 +232,16 @@ public:
             size_ = cnt;
         }
     }
+    void resize_for_overwrite(size_type cnt)
+    {
+        if (cnt < size_) shrink_resize(cnt);
+        else
+        {
+            expand(cnt);
+            nstd::construct_for_overwrite(end(), iter_at(cnt));
+            size_ = cnt;
+        }
+    }
     void swap(vector& other) noexcept
     {
         std::swap(data_, other.data_);
@@ -233,6 +251,39 @@ public:
 
 private:
 
+    // Range dispatch
+    template <typename Iter>
+    using iterator_category = typename std::iterator_traits<Iter>::iterator_category;
+
+    template <typename InputIter>
+    void append_range(InputIter first, InputIter last, std::input_iterator_tag)
+    {
+        nstd::copy(first, last, std::back_insert_iterator<vector>(*this));
+    }
+    template <typename ForwardIter>
+    void append_range(ForwardIter first, ForwardIter last, std::forward_iterator_tag)
+    {
+        size_type cnt = std::distance(first, last);
+        expand(size_ + cnt);
+        nstd::construct_copy(first, last, end());
+        size_ += cnt;
+    }
+    template <typename InputIter>
+    iterator insert_range(difference_type offset, InputIter first, InputIter last, std::input_iterator_tag)
+    {
+        nstd::copy(first, last, std::insert_iterator<vector>(*this, iter_at(offset)));
+        return iter_at(offset);
+    }
+    template <typename ForwardIter>
+    iterator insert_range(difference_type offset, ForwardIter first, ForwardIter last, std::forward_iterator_tag)
+    {
+        iterator mid = shift_right(offset, std::distance(first, last));
+        iterator new_pos = iter_at(offset);
+        auto curr = nstd::copy_to(first, new_pos, mid);
+        nstd::construct_copy(curr, last, mid);
+        return new_pos;
+    }
+
     // Utility functions
     iterator iter_at(size_type idx) noexcept
     {
@@ -258,6 +309,7 @@ private:
     }
     iterator shift_right(difference_type from, difference_type dist)
     {
+        if (dist == 0) return iter_at(from);
         size_type new_size = size_ + dist;
         if (capacity_ < new_size)
         {
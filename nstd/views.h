@@ -0,0 +1,460 @@
+#pragma once
+
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Lazy views over iterator ranges. Views store iterators and their iterators carry
+// everything they need, so a pipeline of temporary views is safe to consume, but the
+// underlying container must outlive it. Nothing is evaluated until the final view is
+// iterated, e.g. by nstd::copy, nstd::construct_copy or a vector's range constructor.
+
+namespace nstd
+{
+    template <typename Iter> class subrange;
+    template <typename Iter, typename Func> class transform_view;
+    template <typename Iter, typename Pred> class filter_view;
+    template <typename Iter> class take_view;
+    template <typename Iter1, typename Iter2> class zip_view;
+    template <typename Iter> class chunk_view;
+    template <typename Iter> class enumerate_view;
+
+    namespace detail
+    {
+        template <typename Range>
+        using range_iterator_t = decltype(std::begin(std::declval<Range&>()));
+
+        template <typename Iter>
+        using view_category_t = typename std::conditional<
+            std::is_convertible<typename std::iterator_traits<Iter>::iterator_category, std::forward_iterator_tag>::value,
+            std::forward_iterator_tag, std::input_iterator_tag>::type;
+
+        template <typename Iter1, typename Iter2>
+        using common_view_category_t = typename std::conditional<
+            std::is_same<view_category_t<Iter1>, std::forward_iterator_tag>::value &&
+            std::is_same<view_category_t<Iter2>, std::forward_iterator_tag>::value,
+            std::forward_iterator_tag, std::input_iterator_tag>::type;
+
+        // Copy-assignable holder for a callable; lambdas with captures cannot be assigned,
+        // but iterators carrying them must be
+        template <typename Func>
+        class func_box
+        {
+        public:
+
+            func_box(const Func& fn) : fn(fn) {}
+            func_box(const func_box& other) : fn(other.fn) {}
+            ~func_box() { fn.~Func(); }
+
+            func_box& operator=(const func_box& other)
+            {
+                if (this == &other) return *this;
+                fn.~Func();
+                new(&fn) Func(other.fn);
+                return *this;
+            }
+
+            template <typename... Args>
+            decltype(auto) operator()(Args&&... args) const { return fn(std::forward<Args>(args)...); }
+
+        private:
+
+            union { mutable Func fn; };
+        };
+    }
+}
+
+namespace nstd
+{
+    namespace views
+    {
+        namespace detail
+        {
+            template <typename Func>
+            struct adaptor
+            {
+                Func fn;
+            };
+            template <typename Func>
+            adaptor<Func> make_adaptor(Func fn)
+            {
+                return adaptor<Func>{fn};
+            }
+            template <typename Range, typename Func>
+            auto operator|(Range&& range, const adaptor<Func>& adapt)
+            {
+                return adapt.fn(range);
+            }
+        }
+
+        template <typename Range, typename Func>
+        auto transform(Range&& range, Func fn) { return transform_view<nstd::detail::range_iterator_t<Range>, Func>(std::begin(range), std::end(range), fn); }
+        template <typename Func>
+        auto transform(Func fn) { return detail::make_adaptor([fn](auto& range) { return transform(range, fn); }); }
+
+        template <typename Range, typename Pred>
+        auto filter(Range&& range, Pred pred) { return filter_view<nstd::detail::range_iterator_t<Range>, Pred>(std::begin(range), std::end(range), pred); }
+        template <typename Pred>
+        auto filter(Pred pred) { return detail::make_adaptor([pred](auto& range) { return filter(range, pred); }); }
+
+        template <typename Range>
+        auto take(Range&& range, size_t cnt) { return take_view<nstd::detail::range_iterator_t<Range>>(std::begin(range), std::end(range), cnt); }
+        inline auto take(size_t cnt) { return detail::make_adaptor([cnt](auto& range) { return take(range, cnt); }); }
+
+        template <typename Range>
+        auto chunk(Range&& range, size_t cnt) { return chunk_view<nstd::detail::range_iterator_t<Range>>(std::begin(range), std::end(range), cnt); }
+        inline auto chunk(size_t cnt) { return detail::make_adaptor([cnt](auto& range) { return chunk(range, cnt); }); }
+
+        template <typename Range>
+        auto enumerate(Range&& range) { return enumerate_view<nstd::detail::range_iterator_t<Range>>(std::begin(range), std::end(range)); }
+        inline auto enumerate() { return detail::make_adaptor([](auto& range) { return enumerate(range); }); }
+
+        template <typename Range1, typename Range2>
+        auto zip(Range1&& range1, Range2&& range2)
+        {
+            return zip_view<nstd::detail::range_iterator_t<Range1>, nstd::detail::range_iterator_t<Range2>>(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2));
+        }
+        template <typename Range2>
+        auto zip(Range2& range2) { return detail::make_adaptor([&range2](auto& range1) { return zip(range1, range2); }); }
+    }
+}
+
+template <typename Iter>
+class nstd::subrange
+{
+public:
+
+    // Types
+    typedef Iter iterator;
+
+    // Constructors
+    subrange(Iter first, Iter last) : first_(first), last_(last) {}
+
+    // Iterators
+    iterator begin() const { return first_; }
+    iterator end()   const { return last_;  }
+
+    // Size
+    bool empty()     const { return first_ == last_; }
+
+private:
+
+    Iter first_;
+    Iter last_;
+};
+
+template <typename Iter, typename Func>
+class nstd::transform_view
+{
+public:
+
+    class iterator
+    {
+    public:
+
+        // Types
+        typedef detail::view_category_t<Iter>                                    iterator_category;
+        typedef decltype(std::declval<Func&>()(*std::declval<Iter>()))  reference;
+        typedef typename std::decay<reference>::type                     value_type;
+        typedef void                                                     pointer;
+        typedef typename std::iterator_traits<Iter>::difference_type     difference_type;
+
+        // Constructors
+        iterator(Iter curr, Func fn) : curr(curr), fn(fn) {}
+
+        // Access
+        reference operator*() const { return fn(*curr); }
+
+        // Iteration
+        iterator& operator++()      { ++curr; return *this; }
+        iterator operator++(int)    { iterator temp = *this; ++curr; return temp; }
+
+        // Comparisons
+        bool operator==(const iterator& other) const { return curr == other.curr; }
+        bool operator!=(const iterator& other) const { return curr != other.curr; }
+
+    private:
+
+        Iter curr;
+        detail::func_box<Func> fn;
+    };
+
+    // Constructors
+    transform_view(Iter first, Iter last, Func fn) : first_(first), last_(last), fn_(fn) {}
+
+    // Iterators
+    iterator begin() const { return iterator(first_, fn_); }
+    iterator end()   const { return iterator(last_, fn_);  }
+
+private:
+
+    Iter first_;
+    Iter last_;
+    Func fn_;
+};
+
+// Single-pass on purpose: sinks that size their output first would otherwise
+// evaluate the predicate twice per element.
+template <typename Iter, typename Pred>
+class nstd::filter_view
+{
+public:
+
+    class iterator
+    {
+    public:
+
+        // Types
+        typedef std::input_iterator_tag                                  iterator_category;
+        typedef typename std::iterator_traits<Iter>::reference           reference;
+        typedef typename std::iterator_traits<Iter>::value_type          value_type;
+        typedef typename std::iterator_traits<Iter>::pointer             pointer;
+        typedef typename std::iterator_traits<Iter>::difference_type     difference_type;
+
+        // Constructors
+        iterator(Iter curr, Iter last, Pred pred) : curr(curr), last(last), pred(pred) { skip(); }
+
+        // Access
+        reference operator*() const { return *curr; }
+
+        // Iteration
+        iterator& operator++()      { ++curr; skip(); return *this; }
+        iterator operator++(int)    { iterator temp = *this; ++*this; return temp; }
+
+        // Comparisons
+        bool operator==(const iterator& other) const { return curr == other.curr; }
+        bool operator!=(const iterator& other) const { return curr != other.curr; }
+
+    private:
+
+        void skip() { while (curr != last && !pred(*curr)) ++curr; }
+
+        Iter curr;
+        Iter last;
+        detail::func_box<Pred> pred;
+    };
+
+    // Constructors
+    filter_view(Iter first, Iter last, Pred pred) : first_(first), last_(last), pred_(pred) {}
+
+    // Iterators
+    iterator begin() const { return iterator(first_, last_, pred_); }
+    iterator end()   const { return iterator(last_, last_, pred_);  }
+
+private:
+
+    Iter first_;
+    Iter last_;
+    Pred pred_;
+};
+
+template <typename Iter>
+class nstd::take_view
+{
+public:
+
+    class iterator
+    {
+    public:
+
+        // Types
+        typedef detail::view_category_t<Iter>                                    iterator_category;
+        typedef typename std::iterator_traits<Iter>::reference           reference;
+        typedef typename std::iterator_traits<Iter>::value_type          value_type;
+        typedef typename std::iterator_traits<Iter>::pointer             pointer;
+        typedef typename std::iterator_traits<Iter>::difference_type     difference_type;
+
+        // Constructors
+        iterator(Iter curr, size_t left) : curr(curr), left(left) {}
+
+        // Access
+        reference operator*() const { return *curr; }
+
+        // Iteration
+        iterator& operator++()      { ++curr; --left; return *this; }
+        iterator operator++(int)    { iterator temp = *this; ++*this; return temp; }
+
+        // Comparisons
+        bool operator==(const iterator& other) const { return left == other.left || curr == other.curr;   }
+        bool operator!=(const iterator& other) const { return left != other.left && curr != other.curr; }
+
+    private:
+
+        Iter curr;
+        size_t left;
+    };
+
+    // Constructors
+    take_view(Iter first, Iter last, size_t cnt) : first_(first), last_(last), cnt_(cnt) {}
+
+    // Iterators
+    iterator begin() const { return iterator(first_, cnt_); }
+    iterator end()   const { return iterator(last_, 0);     }
+
+private:
+
+    Iter first_;
+    Iter last_;
+    size_t cnt_;
+};
+
+template <typename Iter1, typename Iter2>
+class nstd::zip_view
+{
+public:
+
+    class iterator
+    {
+    public:
+
+        // Types
+        typedef detail::common_view_category_t<Iter1, Iter2>                     iterator_category;
+        typedef std::pair<typename std::iterator_traits<Iter1>::reference,
+                          typename std::iterator_traits<Iter2>::reference> reference;
+        typedef std::pair<typename std::iterator_traits<Iter1>::value_type,
+                          typename std::iterator_traits<Iter2>::value_type> value_type;
+        typedef void                                                     pointer;
+        typedef typename std::iterator_traits<Iter1>::difference_type    difference_type;
+
+        // Constructors
+        iterator(Iter1 curr1, Iter2 curr2) : curr1(curr1), curr2(curr2) {}
+
+        // Access
+        reference operator*() const { return reference(*curr1, *curr2); }
+
+        // Iteration
+        iterator& operator++()      { ++curr1; ++curr2; return *this; }
+        iterator operator++(int)    { iterator temp = *this; ++*this; return temp; }
+
+        // Comparisons
+        bool operator==(const iterator& other) const { return curr1 == other.curr1 || curr2 == other.curr2; }
+        bool operator!=(const iterator& other) const { return curr1 != other.curr1 && curr2 != other.curr2; }
+
+    private:
+
+        Iter1 curr1;
+        Iter2 curr2;
+    };
+
+    // Constructors
+    zip_view(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2) : first1_(first1), last1_(last1), first2_(first2), last2_(last2) {}
+
+    // Iterators
+    iterator begin() const { return iterator(first1_, first2_); }
+    iterator end()   const { return iterator(last1_, last2_);   }
+
+private:
+
+    Iter1 first1_;
+    Iter1 last1_;
+    Iter2 first2_;
+    Iter2 last2_;
+};
+
+template <typename Iter>
+class nstd::chunk_view
+{
+public:
+
+    class iterator
+    {
+    public:
+
+        // Types
+        typedef detail::view_category_t<Iter>                                    iterator_category;
+        typedef subrange<Iter>                                           reference;
+        typedef subrange<Iter>                                           value_type;
+        typedef void                                                     pointer;
+        typedef typename std::iterator_traits<Iter>::difference_type     difference_type;
+
+        // Constructors
+        iterator(Iter curr, Iter last, size_t cnt) : curr(curr), next(curr), last(last), cnt(cnt) { find_next(); }
+
+        // Access
+        reference operator*() const { return reference(curr, next); }
+
+        // Iteration
+        iterator& operator++()      { curr = next; find_next(); return *this; }
+        iterator operator++(int)    { iterator temp = *this; ++*this; return temp; }
+
+        // Comparisons
+        bool operator==(const iterator& other) const { return curr == other.curr; }
+        bool operator!=(const iterator& other) const { return curr != other.curr; }
+
+    private:
+
+        void find_next() { for (size_t i = 0; i < cnt && next != last; ++i) ++next; }
+
+        Iter curr;
+        Iter next;
+        Iter last;
+        size_t cnt;
+    };
+
+    // Constructors
+    chunk_view(Iter first, Iter last, size_t cnt) : first_(first), last_(last), cnt_(cnt)
+    {
+        if (cnt == 0) throw std::invalid_argument("nstd::chunk_view: chunk size must be positive");
+    }
+
+    // Iterators
+    iterator begin() const { return iterator(first_, last_, cnt_); }
+    iterator end()   const { return iterator(last_, last_, cnt_);  }
+
+private:
+
+    Iter first_;
+    Iter last_;
+    size_t cnt_;
+};
+
+template <typename Iter>
+class nstd::enumerate_view
+{
+public:
+
+    class iterator
+    {
+    public:
+
+        // Types
+        typedef detail::view_category_t<Iter>                                      iterator_category;
+        typedef std::pair<size_t, typename std::iterator_traits<Iter>::reference>  reference;
+        typedef std::pair<size_t, typename std::iterator_traits<Iter>::value_type> value_type;
+        typedef void                                                       pointer;
+        typedef typename std::iterator_traits<Iter>::difference_type       difference_type;
+
+        // Constructors
+        iterator(Iter curr, size_t idx) : curr(curr), idx(idx) {}
+
+        // Access
+        reference operator*() const { return reference(idx, *curr); }
+
+        // Iteration
+        iterator& operator++()      { ++curr; ++idx; return *this; }
+        iterator operator++(int)    { iterator temp = *this; ++*this; return temp; }
+
+        // Comparisons
+        bool operator==(const iterator& other) const { return curr == other.curr; }
+        bool operator!=(const iterator& other) const { return curr != other.curr; }
+
+    private:
+
+        Iter curr;
+        size_t idx;
+    };
+
+    // Constructors
+    enumerate_view(Iter first, Iter last) : first_(first), last_(last) {}
+
+    // Iterators
+    iterator begin() const { return iterator(first_, 0); }
+    iterator end()   const { return iterator(last_, 0);  }
+
+private:
+
+    Iter first_;
+    Iter last_;
+};